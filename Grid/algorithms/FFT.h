@@ -106,7 +106,6 @@ class FFT {
 private:
     
   GridCartesian *vgrid;
-  GridCartesian *sgrid;
     
   int Nd;
   double flops;
@@ -116,6 +115,44 @@ private:
   Coordinate dimensions;
   Coordinate processors;
   Coordinate processor_coor;
+
+#ifdef HAVE_FFTW
+  ////////////////////////////////////////////////////////////////////////////
+  // Plans depend only on the transform length, the interleaving of the lines
+  // and the sign, so they are kept for the life of the process and shared by
+  // every FFT object; callers typically construct one per solve or per
+  // iteration.
+  ////////////////////////////////////////////////////////////////////////////
+  template<class scalar>
+  static std::map<std::vector<int>,typename FFTW<scalar>::FFTW_plan> &PlanCache(void)
+  {
+    static std::map<std::vector<int>,typename FFTW<scalar>::FFTW_plan> cache;
+    return cache;
+  }
+  template<class scalar>
+  static typename FFTW<scalar>::FFTW_plan GetPlan(int G,int stride,int Ncomp,int sign,scalar *buf)
+  {
+    typedef typename FFTW<scalar>::FFTW_scalar FFTW_scalar;
+    auto &cache = PlanCache<scalar>();
+    std::vector<int> key({G,stride,Ncomp,sign});
+    auto it = cache.find(key);
+    if ( it != cache.end() ) return it->second;
+
+    int rank = 1;  /* 1d transforms */
+    int n[] = {G}; /* 1d transforms of length G */
+    int howmany = Ncomp;
+    int idist   = 1;        /* Distance between consecutive FT's */
+    int istride = stride;   /* distance between two elements in the same FT */
+    int *inembed = n;
+    FFTW_scalar *in = (FFTW_scalar *)buf;
+    auto p = FFTW<scalar>::fftw_plan_many_dft(rank,n,howmany,
+					      in,inembed,istride,idist,
+					      in,inembed,istride,idist,
+					      sign,FFTW_ESTIMATE);
+    cache[key] = p;
+    return p;
+  }
+#endif
     
 public:
     
@@ -135,12 +172,18 @@ public:
   {
     flops=0;
     usec =0;
-    Coordinate layout(Nd,1);
-    sgrid = new GridCartesian(dimensions,layout,processors,*grid);
   };
     
   ~FFT ( void)  {
-    delete sgrid;
+  }
+
+  static void ClearPlanCache(void) {
+#ifdef HAVE_FFTW
+    for(auto &p : PlanCache<ComplexD>()) FFTW<ComplexD>::fftw_destroy_plan(p.second);
+    for(auto &p : PlanCache<ComplexF>()) FFTW<ComplexF>::fftw_destroy_plan(p.second);
+    PlanCache<ComplexD>().clear();
+    PlanCache<ComplexF>().clear();
+#endif
   }
     
   template<class vobj>
@@ -164,7 +207,20 @@ public:
     FFT_dim_mask(result,source,mask,sign);
   }
 
-
+  ////////////////////////////////////////////////////////////////////////////
+  // Transpose based transform in one dimension.
+  //
+  // The Northo local lines orthogonal to dim are dealt out in P chunks of C,
+  // one chunk per rank along dim. A single all-to-all down dim leaves each
+  // rank holding complete lines of length G = P*L for its chunk, laid out as
+  //
+  //    pencil[g][c][comp] ,  g = p*L + l
+  //
+  // which is exactly the order the exchange delivers, so no local reorder is
+  // needed. The lines are transformed in place and sent back the same way.
+  // Each rank moves (P-1)/P of its local volume each way, rather than the
+  // whole volume P-1 times as the barrel shift did.
+  ////////////////////////////////////////////////////////////////////////////
   template<class vobj>
   void FFT_dim(Lattice<vobj> &result,const Lattice<vobj> &source,int dim, int sign){
 #ifndef HAVE_FFTW
@@ -173,120 +229,133 @@ public:
     conformable(result.Grid(),vgrid);
     conformable(source.Grid(),vgrid);
 
-    int L = vgrid->_ldimensions[dim];
-    int G = vgrid->_fdimensions[dim];
-      
-    Coordinate layout(Nd,1);
-    Coordinate pencil_gd(vgrid->_fdimensions);
-      
-    pencil_gd[dim] = G*processors[dim];
-      
-    // Pencil global vol LxLxGxLxL per node
-    GridCartesian pencil_g(pencil_gd,layout,processors,*vgrid);
-      
-    // Construct pencils
     typedef typename vobj::scalar_object sobj;
     typedef typename sobj::scalar_type   scalar;
-      
-    Lattice<sobj> pgbuf(&pencil_g);
-    autoView(pgbuf_v , pgbuf, CpuWrite);
 
-    typedef typename FFTW<scalar>::FFTW_scalar FFTW_scalar;
-    typedef typename FFTW<scalar>::FFTW_plan   FFTW_plan;
-      
+    int L  = vgrid->_ldimensions[dim];
+    int G  = vgrid->_fdimensions[dim];
+    int P  = processors[dim];
+    int pc = processor_coor[dim];
+
     int Ncomp = sizeof(sobj)/sizeof(scalar);
     int Nlow  = 1;
     for(int d=0;d<dim;d++){
       Nlow*=vgrid->_ldimensions[d];
     }
-      
-    int rank = 1;  /* 1d transforms */
-    int n[] = {G}; /* 1d transforms of length G */
-    int howmany = Ncomp;
-    int odist,idist,istride,ostride;
-    idist   = odist   = 1;          /* Distance between consecutive FT's */
-    istride = ostride = Ncomp*Nlow; /* distance between two elements in the same FT */
-    int *inembed = n, *onembed = n;
-      
+    int Nloc   = vgrid->lSites();
+    int Northo = Nloc/L;
+    int C      = (Northo+P-1)/P;  // lines per rank after the transpose
+
     scalar div;
     if ( sign == backward ) div = 1.0/G;
     else if ( sign == forward ) div = 1.0;
     else assert(0);
-      
-    FFTW_plan p;
+
+    // Chunk q of pencil holds the lines destined for rank q; our own chunk is
+    // packed straight into place and never travels.
+    std::vector<sobj,alignedAllocator<sobj> > pencil(G*C);
+    std::vector<sobj,alignedAllocator<sobj> > buf(G*C);
+    uint64_t chunk = (uint64_t)L*C;
+    uint64_t bytes = chunk*sizeof(sobj);
+    assert(bytes < (1ULL<<31));
+
+    auto line_slot = [=](int idx) -> uint64_t {
+      int l = (idx/Nlow)%L;
+      int o = idx%Nlow + Nlow*(idx/(Nlow*L));
+      int q = o/C;
+      int c = o%C;
+      return ((uint64_t)q*L+l)*C+c;
+    };
+    auto own = [=](uint64_t slot) { return (int)(slot/chunk) == pc; };
+
     {
-      FFTW_scalar *in = (FFTW_scalar *)&pgbuf_v[0];
-      FFTW_scalar *out= (FFTW_scalar *)&pgbuf_v[0];
-      p = FFTW<scalar>::fftw_plan_many_dft(rank,n,howmany,
-					   in,inembed,
-					   istride,idist,
-					   out,onembed,
-					   ostride, odist,
-					   sign,FFTW_ESTIMATE);
-    }
-      
-    // Barrel shift and collect global pencil
-    Coordinate lcoor(Nd), gcoor(Nd);
-    result = source;
-    int pc = processor_coor[dim];
-    for(int p=0;p<processors[dim];p++) {
-      {
-	autoView(r_v,result,CpuRead);
-	autoView(p_v,pgbuf,CpuWrite);
-	thread_for(idx, sgrid->lSites(),{
-          Coordinate cbuf(Nd);
-          sobj s;
-	  sgrid->LocalIndexToLocalCoor(idx,cbuf);
-	  peekLocalSite(s,r_v,cbuf);
-	  cbuf[dim]+=((pc+p) % processors[dim])*L;
-	  pokeLocalSite(s,p_v,cbuf);
-        });
-      }
-      if (p != processors[dim] - 1) {
-	result = Cshift(result,dim,L);
+      autoView(s_v,source,CpuRead);
+      sobj *pencil_p = &pencil[0];
+      sobj *buf_p    = &buf[0];
+      thread_for(idx,Nloc,{
+	Coordinate cbuf(Nd);
+	sobj s;
+	vgrid->LocalIndexToLocalCoor(idx,cbuf);
+	peekLocalSite(s,s_v,cbuf);
+	uint64_t slot = line_slot(idx);
+	if ( own(slot) ) pencil_p[slot] = s;
+	else             buf_p[slot]    = s;
+      });
+      // Padding lines in the last chunk
+      for(int o=Northo;o<P*C;o++){
+	int q = o/C, c = o%C;
+	for(int l=0;l<L;l++){
+	  uint64_t slot = ((uint64_t)q*L+l)*C+c;
+	  if ( q==pc ) pencil_p[slot] = Zero();
+	  else         buf_p[slot]    = Zero();
+	}
       }
     }
-      
-    // Loop over orthog coords
-    int NN=pencil_g.lSites();
+
+    // Pairwise exchange down dim: at step s send chunk pc+s, receive chunk pc-s
+    Coordinate coor(processor_coor);
+    for(int s=1;s<P;s++){
+      int q = (pc+s)%P;
+      int p = (pc-s+P)%P;
+      coor[dim]=q; int xmit_to_rank   = vgrid->RankFromProcessorCoor(coor);
+      coor[dim]=p; int recv_from_rank = vgrid->RankFromProcessorCoor(coor);
+      vgrid->SendToRecvFrom((void *)&buf[q*chunk],xmit_to_rank,
+			    (void *)&pencil[p*chunk],recv_from_rank,
+			    bytes);
+    }
+
+    // Transform the C local lines; each line batches all Ncomp components
+    typedef typename FFTW<scalar>::FFTW_scalar FFTW_scalar;
+    typedef typename FFTW<scalar>::FFTW_plan   FFTW_plan;
+    scalar *pencil_s = (scalar *)&pencil[0];
+    FFTW_plan plan = GetPlan<scalar>(G,C*Ncomp,Ncomp,sign,pencil_s);
+
     GridStopWatch timer;
     timer.Start();
-    thread_for( idx,NN,{
-        Coordinate cbuf(Nd);
-	pencil_g.LocalIndexToLocalCoor(idx, cbuf);
-	if ( cbuf[dim] == 0 ) {  // restricts loop to plane at lcoor[dim]==0
-	  FFTW_scalar *in = (FFTW_scalar *)&pgbuf_v[idx];
-	  FFTW_scalar *out= (FFTW_scalar *)&pgbuf_v[idx];
-	  FFTW<scalar>::fftw_execute_dft(p,in,out);
+    thread_for( c,C,{
+      FFTW_scalar *in = (FFTW_scalar *)&pencil_s[c*Ncomp];
+      FFTW<scalar>::fftw_execute_dft(plan,in,in);
+      if ( sign == backward ) {
+	for(int g=0;g<G;g++){
+	  for(int n=0;n<Ncomp;n++){
+	    pencil_s[((uint64_t)g*C+c)*Ncomp+n] *= div;
+	  }
 	}
+      }
     });
     timer.Stop();
-      
+
     // performance counting
     double add,mul,fma;
-    FFTW<scalar>::fftw_flops(p,&add,&mul,&fma);
+    FFTW<scalar>::fftw_flops(plan,&add,&mul,&fma);
     flops_call = add+mul+2.0*fma;
     usec += timer.useconds();
-    flops+= flops_call*NN;
-      
+    flops+= flops_call*C;
+
+    // Transpose back
+    for(int s=1;s<P;s++){
+      int q = (pc+s)%P;
+      int p = (pc-s+P)%P;
+      coor[dim]=q; int xmit_to_rank   = vgrid->RankFromProcessorCoor(coor);
+      coor[dim]=p; int recv_from_rank = vgrid->RankFromProcessorCoor(coor);
+      vgrid->SendToRecvFrom((void *)&pencil[q*chunk],xmit_to_rank,
+			    (void *)&buf[p*chunk],recv_from_rank,
+			    bytes);
+    }
+
     // writing out result
     {
-      autoView(pgbuf_v,pgbuf,CpuRead);
       autoView(result_v,result,CpuWrite);
-      thread_for(idx,sgrid->lSites(),{
-	Coordinate clbuf(Nd), cgbuf(Nd);
-	sobj s;
-	sgrid->LocalIndexToLocalCoor(idx,clbuf);
-	cgbuf = clbuf;
-	cgbuf[dim] = clbuf[dim]+L*pc;
-	peekLocalSite(s,pgbuf_v,cgbuf);
-	pokeLocalSite(s,result_v,clbuf);
+      sobj *pencil_p = &pencil[0];
+      sobj *buf_p    = &buf[0];
+      thread_for(idx,Nloc,{
+	Coordinate cbuf(Nd);
+	vgrid->LocalIndexToLocalCoor(idx,cbuf);
+	uint64_t slot = line_slot(idx);
+	if ( own(slot) ) pokeLocalSite(pencil_p[slot],result_v,cbuf);
+	else             pokeLocalSite(buf_p[slot],   result_v,cbuf);
       });
     }
-    result = result*div;
-      
-    // destroying plan
-    FFTW<scalar>::fftw_destroy_plan(p);
 #endif
   }
 };
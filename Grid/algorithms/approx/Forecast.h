@@ -147,6 +147,62 @@ public:
   };
 };
 
+// Presents a LinearOperatorBase as M = Op, Mdag = AdjOp so that the
+// forecast minimises over HermOp = AdjOp Op, the operator the solver sees.
+template<class Field>
+class ForecastLinearOperator
+{
+public:
+  LinearOperatorBase<Field> &Linop;
+  ForecastLinearOperator(LinearOperatorBase<Field> &_Linop) : Linop(_Linop) {};
+  void M   (const Field &in, Field &out) { Linop.Op(in,out); }
+  void Mdag(const Field &in, Field &out) { Linop.AdjOp(in,out); }
+};
+
+// Chronological initial guess for the repeated solves of an MD force
+// (Brower et al., arXiv:hep-lat/9509012).
+//
+// Keeps the last MaxDegree solutions and forecasts the next one as their
+// minimal residual combination for the current operator. Degree zero
+// disables it and the guess is zero. The history must be cleared when the
+// pseudofermion is refreshed; within a trajectory the guess only changes
+// the answer at the level of the solver tolerance.
+template<class Field>
+class ChronoSolutionHistory
+{
+public:
+  int MaxDegree;
+  std::vector<Field> solns;
+
+  ChronoSolutionHistory(int degree=0) : MaxDegree(degree) {};
+
+  void setMaxDegree(int degree)
+  {
+    MaxDegree = std::max(degree,0);
+    if ( (int)solns.size() > MaxDegree ) solns.erase(solns.begin(),solns.end()-MaxDegree);
+  }
+  int  Degree(void) { return solns.size(); }
+  void clear(void) { solns.clear(); }
+
+  void Guess(LinearOperatorBase<Field> &HermOp, const Field &src, Field &psi)
+  {
+    if ( solns.size() == 0 ) {
+      psi = Zero();
+      return;
+    }
+    ForecastLinearOperator<Field> Mat(HermOp);
+    ChronoForecast<ForecastLinearOperator<Field>,Field> Forecast;
+    psi = Forecast(Mat, src, solns);
+  }
+
+  void Update(const Field &psi)
+  {
+    if ( MaxDegree <= 0 ) return;
+    if ( (int)solns.size() == MaxDegree ) solns.erase(solns.begin());
+    solns.push_back(psi);
+  }
+};
+
 NAMESPACE_END(Grid);
 
 #endif
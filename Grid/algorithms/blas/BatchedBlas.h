@@ -42,6 +42,9 @@ Author: Peter Boyle <pboyle@bnl.gov>
 #ifdef GRID_ONE_MKL
 #include <oneapi/mkl.hpp>
 #endif
+#if defined(USE_MKL) && !defined(GRID_SYCL) && !defined(GRID_CUDA) && !defined(GRID_HIP)
+#include <mkl_cblas.h>
+#endif
 
 ///////////////////////////////////////////////////////////////////////	  
 // Need to rearrange lattice data to be in the right format for a
@@ -132,6 +135,182 @@ public:
     gridblasHandle->wait();
 #endif
   }
+
+#if !defined(GRID_SYCL) && !defined(GRID_CUDA) && !defined(GRID_HIP)
+  /////////////////////////////////////////////////////////////////////////////////////
+  // Host batched GEMM for CPU only builds
+  // - (batch, m-tile, n-tile) blocks of C are distributed over threads
+  // - k is blocked, and the op(A) and op(B) panels are packed into split
+  //   real/imaginary buffers with any conjugation applied, so the inner loop is a
+  //   fixed length real FMA sweep over MB rows that the compiler vectorises
+  // - C is not read when beta is zero, as in BLAS
+  // With --enable-mkl the whole batch is handed to cblas_?gemm_batch instead.
+  /////////////////////////////////////////////////////////////////////////////////////
+  static constexpr int HostMB = 32;
+  static constexpr int HostNB = 4;
+  static constexpr int HostKB = 64;
+
+  template<class scalar>
+  static inline void gemmHostTile(GridBLASOperation_t OpA,
+				  GridBLASOperation_t OpB,
+				  int m0,int mb,int n0,int nb,int k,
+				  int lda,int ldb,int ldc,
+				  scalar alpha,
+				  const scalar *Amk,
+				  const scalar *Bkn,
+				  scalar beta,
+				  scalar *Cmn)
+  {
+    typedef typename RealPart<scalar>::type rscalar;
+    constexpr int cplx = is_complex<scalar>::value ? 2 : 1;
+    constexpr int MB = HostMB;
+    constexpr int NB = HostNB;
+    constexpr int KB = HostKB;
+
+    const rscalar *A = (const rscalar *)Amk;
+    const rscalar *B = (const rscalar *)Bkn;
+    rscalar       *C = (rscalar *)Cmn;
+    const rscalar sa = (OpA==GridBLAS_OP_C) ? -1.0 : 1.0;
+    const rscalar sb = (OpB==GridBLAS_OP_C) ? -1.0 : 1.0;
+
+    alignas(64) rscalar acc_re[NB][MB];
+    alignas(64) rscalar acc_im[NB][MB];
+    alignas(64) rscalar a_re[KB][MB];
+    alignas(64) rscalar a_im[KB][MB];
+    rscalar b_re[NB][KB];
+    rscalar b_im[NB][KB];
+
+    for(int nn=0;nn<NB;nn++){
+      for(int mm=0;mm<MB;mm++){
+	acc_re[nn][mm]=0.0;
+	acc_im[nn][mm]=0.0;
+      }
+    }
+
+    for(int k0=0;k0<k;k0+=KB){
+      int kb = std::min(KB,k-k0);
+
+      // Pack op(A)(m0:m0+mb, k0:k0+kb), zero padded to MB rows
+      for(int kk=0;kk<kb;kk++){
+	for(int mm=0;mm<MB;mm++){
+	  a_re[kk][mm]=0.0;
+	  a_im[kk][mm]=0.0;
+	}
+	for(int mm=0;mm<mb;mm++){
+	  int64_t o = (OpA==GridBLAS_OP_N) ? (m0+mm) + (int64_t)(k0+kk)*lda : (k0+kk) + (int64_t)(m0+mm)*lda;
+	  a_re[kk][mm] = A[cplx*o];
+	  if constexpr (cplx==2) a_im[kk][mm] = sa*A[cplx*o+1];
+	}
+      }
+      // Pack op(B)(k0:k0+kb, n0:n0+nb)
+      for(int nn=0;nn<nb;nn++){
+	for(int kk=0;kk<kb;kk++){
+	  int64_t o = (OpB==GridBLAS_OP_N) ? (k0+kk) + (int64_t)(n0+nn)*ldb : (n0+nn) + (int64_t)(k0+kk)*ldb;
+	  b_re[nn][kk] = B[cplx*o];
+	  b_im[nn][kk] = 0.0;
+	  if constexpr (cplx==2) b_im[nn][kk] = sb*B[cplx*o+1];
+	}
+      }
+      // acc(:,nn) += op(A)(:,kk) op(B)(kk,nn)
+      for(int nn=0;nn<nb;nn++){
+	for(int kk=0;kk<kb;kk++){
+	  rscalar br = b_re[nn][kk];
+	  rscalar bi = b_im[nn][kk];
+	  if constexpr (cplx==2) {
+	    for(int mm=0;mm<MB;mm++){
+	      acc_re[nn][mm] += a_re[kk][mm]*br - a_im[kk][mm]*bi;
+	      acc_im[nn][mm] += a_re[kk][mm]*bi + a_im[kk][mm]*br;
+	    }
+	  } else {
+	    for(int mm=0;mm<MB;mm++){
+	      acc_re[nn][mm] += a_re[kk][mm]*br;
+	    }
+	  }
+	}
+      }
+    }
+
+    // C = alpha acc + beta C
+    const rscalar *alpha_p = (const rscalar *)&alpha;
+    const rscalar *beta_p  = (const rscalar *)&beta;
+    rscalar alpha_re = alpha_p[0], alpha_im = 0.0;
+    rscalar beta_re  = beta_p[0],  beta_im  = 0.0;
+    if constexpr (cplx==2) {
+      alpha_im = alpha_p[1];
+      beta_im  = beta_p[1];
+    }
+    bool    beta_zero= (beta_re==0.0) && (beta_im==0.0);
+    for(int nn=0;nn<nb;nn++){
+      for(int mm=0;mm<mb;mm++){
+	int64_t o = cplx*((m0+mm) + (int64_t)(n0+nn)*ldc);
+	rscalar cr = alpha_re*acc_re[nn][mm] - alpha_im*acc_im[nn][mm];
+	rscalar ci = alpha_re*acc_im[nn][mm] + alpha_im*acc_re[nn][mm];
+	if ( !beta_zero ) {
+	  rscalar Cr = C[o], Ci = 0.0;
+	  if constexpr (cplx==2) Ci = C[o+1];
+	  cr += beta_re*Cr - beta_im*Ci;
+	  ci += beta_re*Ci + beta_im*Cr;
+	}
+	C[o] = cr;
+	if constexpr (cplx==2) C[o+1] = ci;
+      }
+    }
+  }
+
+  template<class scalar>
+  static void gemmBatchedHost(GridBLASOperation_t OpA,
+			      GridBLASOperation_t OpB,
+			      int m,int n, int k,
+			      scalar alpha,
+			      deviceVector<scalar*> &Amk,
+			      deviceVector<scalar*> &Bkn,
+			      scalar beta,
+			      deviceVector<scalar*> &Cmn)
+  {
+    int64_t batchCount = Amk.size();
+    int lda = (OpA==GridBLAS_OP_N) ? m : k;
+    int ldb = (OpB==GridBLAS_OP_N) ? k : n;
+    int ldc = m;
+#ifdef USE_MKL
+    CBLAS_TRANSPOSE tA = (OpA==GridBLAS_OP_N) ? CblasNoTrans : ((OpA==GridBLAS_OP_T) ? CblasTrans : CblasConjTrans);
+    CBLAS_TRANSPOSE tB = (OpB==GridBLAS_OP_N) ? CblasNoTrans : ((OpB==GridBLAS_OP_T) ? CblasTrans : CblasConjTrans);
+    MKL_INT m_i=m, n_i=n, k_i=k, lda_i=lda, ldb_i=ldb, ldc_i=ldc, size_i=batchCount;
+    if constexpr (std::is_same<scalar,ComplexD>::value) {
+      cblas_zgemm_batch(CblasColMajor,&tA,&tB,&m_i,&n_i,&k_i,
+			(const void *)&alpha,(const void **)&Amk[0],&lda_i,(const void **)&Bkn[0],&ldb_i,
+			(const void *)&beta,(void **)&Cmn[0],&ldc_i,1,&size_i);
+    } else if constexpr (std::is_same<scalar,ComplexF>::value) {
+      cblas_cgemm_batch(CblasColMajor,&tA,&tB,&m_i,&n_i,&k_i,
+			(const void *)&alpha,(const void **)&Amk[0],&lda_i,(const void **)&Bkn[0],&ldb_i,
+			(const void *)&beta,(void **)&Cmn[0],&ldc_i,1,&size_i);
+    } else if constexpr (std::is_same<scalar,RealD>::value) {
+      cblas_dgemm_batch(CblasColMajor,&tA,&tB,&m_i,&n_i,&k_i,
+			&alpha,(const double **)&Amk[0],&lda_i,(const double **)&Bkn[0],&ldb_i,
+			&beta,(double **)&Cmn[0],&ldc_i,1,&size_i);
+    } else {
+      cblas_sgemm_batch(CblasColMajor,&tA,&tB,&m_i,&n_i,&k_i,
+			&alpha,(const float **)&Amk[0],&lda_i,(const float **)&Bkn[0],&ldb_i,
+			&beta,(float **)&Cmn[0],&ldc_i,1,&size_i);
+    }
+#else
+    int64_t mtiles = (m+HostMB-1)/HostMB;
+    int64_t ntiles = (n+HostNB-1)/HostNB;
+    scalar **A = &Amk[0];
+    scalar **B = &Bkn[0];
+    scalar **C = &Cmn[0];
+    thread_for(item, batchCount*mtiles*ntiles, {
+      int64_t p  = item / (mtiles*ntiles);
+      int64_t mt = (item / ntiles) % mtiles;
+      int64_t nt = item % ntiles;
+      int m0 = mt*HostMB;
+      int n0 = nt*HostNB;
+      int mb = std::min(HostMB,m-m0);
+      int nb = std::min(HostNB,n-n0);
+      gemmHostTile(OpA,OpB,m0,mb,n0,nb,k,lda,ldb,ldc,alpha,A[p],B[p],beta,C[p]);
+    });
+#endif
+  }
+#endif
   
   void gemmBatched(int m,int n, int k,
 		   ComplexD alpha,
@@ -216,11 +395,13 @@ public:
     if(OpB!=GridBLAS_OP_N)
       ldb = n;
     
+#if defined(GRID_SYCL) || defined(GRID_CUDA) || defined(GRID_HIP)
     static deviceVector<ComplexD> alpha_p(1);
     static deviceVector<ComplexD> beta_p(1);
     // can prestore the 1 and the zero on device
     acceleratorCopyToDevice((void *)&alpha,(void *)&alpha_p[0],sizeof(ComplexD));
     acceleratorCopyToDevice((void *)&beta ,(void *)&beta_p[0],sizeof(ComplexD));
+#endif
     RealD t0=usecond();
     //    std::cout << "ZgemmBatched mnk  "<<m<<","<<n<<","<<k<<" count "<<batchCount<<std::endl;
 #ifdef GRID_HIP
@@ -309,20 +490,7 @@ public:
       }
 #endif
 #if !defined(GRID_SYCL) && !defined(GRID_CUDA) && !defined(GRID_HIP)
-    // Need a default/reference implementation
-    int sda = lda*k;
-    int sdb = ldb*k;
-    int sdc = ldc*n;
-    for (int p = 0; p < batchCount; ++p) {
-      for (int mm = 0; mm < m; ++mm) {
-	for (int nn = 0; nn < n; ++nn) {
-	  ComplexD c_mn(0.0);
-	  for (int kk = 0; kk < k; ++kk)
-	    c_mn += Amk[p][mm + kk*lda ] * Bkn[p][kk + nn*ldb];
-	  Cmn[p][mm + nn*ldc] =  (alpha)*c_mn + (beta)*Cmn[p][mm + nn*ldc ];
-	}
-      }
-    }
+    gemmBatchedHost(OpA,OpB,m,n,k,alpha,Amk,Bkn,beta,Cmn);
 #endif
      RealD t1=usecond();
      RealD flops = 8.0*m*n*k*batchCount;
@@ -351,11 +519,13 @@ public:
       lda = k;
     if(OpB!=GridBLAS_OP_N)
       ldb = n;
+#if defined(GRID_SYCL) || defined(GRID_CUDA) || defined(GRID_HIP)
     static deviceVector<ComplexF> alpha_p(1);
     static deviceVector<ComplexF> beta_p(1);
     // can prestore the 1 and the zero on device
     acceleratorCopyToDevice((void *)&alpha,(void *)&alpha_p[0],sizeof(ComplexF));
     acceleratorCopyToDevice((void *)&beta ,(void *)&beta_p[0],sizeof(ComplexF));
+#endif
     RealD t0=usecond();
 
     assert(Bkn.size()==batchCount);
@@ -425,22 +595,7 @@ public:
     synchronise();
 #endif
 #if !defined(GRID_SYCL) && !defined(GRID_CUDA) && !defined(GRID_HIP)
-    int sda = lda*k;
-    int sdb = ldb*k;
-    int sdc = ldc*n;
-    ComplexF alphaf(real(alpha),imag(alpha));
-    ComplexF betaf(real(beta),imag(beta));
-    // Need a default/reference implementation
-    for (int p = 0; p < batchCount; ++p) {
-      for (int mm = 0; mm < m; ++mm) {
-	for (int nn = 0; nn < n; ++nn) {
-	  ComplexF c_mn(0.0);
-	  for (int kk = 0; kk < k; ++kk)
-	    c_mn += Amk[p][mm + kk*lda ] * Bkn[p][kk + nn*ldb];
-	  Cmn[p][mm + nn*ldc] =  (alphaf)*c_mn + (betaf)*Cmn[p][mm + nn*ldc ];
-	}
-      }
-    }
+    gemmBatchedHost(OpA,OpB,m,n,k,alpha,Amk,Bkn,beta,Cmn);
 #endif
      RealD t1=usecond();
      RealD flops = 8.0*m*n*k*batchCount;
@@ -470,11 +625,13 @@ public:
       lda = k;
     if(OpB!=GridBLAS_OP_N)
       ldb = n;
+#if defined(GRID_SYCL) || defined(GRID_CUDA) || defined(GRID_HIP)
     static deviceVector<RealF> alpha_p(1);
     static deviceVector<RealF> beta_p(1);
     // can prestore the 1 and the zero on device
     acceleratorCopyToDevice((void *)&alpha,(void *)&alpha_p[0],sizeof(RealF));
     acceleratorCopyToDevice((void *)&beta ,(void *)&beta_p[0],sizeof(RealF));
+#endif
     RealD t0=usecond();
 
     assert(Bkn.size()==batchCount);
@@ -543,20 +700,7 @@ public:
     synchronise();
 #endif
 #if !defined(GRID_SYCL) && !defined(GRID_CUDA) && !defined(GRID_HIP)
-    int sda = lda*k;
-    int sdb = ldb*k;
-    int sdc = ldc*n;
-    // Need a default/reference implementation
-    for (int p = 0; p < batchCount; ++p) {
-      for (int mm = 0; mm < m; ++mm) {
-	for (int nn = 0; nn < n; ++nn) {
-	  RealD c_mn(0.0);
-	  for (int kk = 0; kk < k; ++kk)
-	    c_mn += Amk[p][mm + kk*lda ] * Bkn[p][kk + nn*ldb];
-	  Cmn[p][mm + nn*ldc] =  (alpha)*c_mn + (beta)*Cmn[p][mm + nn*ldc ];
-	}
-      }
-    }
+    gemmBatchedHost(OpA,OpB,m,n,k,alpha,Amk,Bkn,beta,Cmn);
 #endif
      RealD t1=usecond();
      RealD flops = 2.0*m*n*k*batchCount;
@@ -588,11 +732,13 @@ public:
     if(OpB!=GridBLAS_OP_N)
       ldb = n;
     
+#if defined(GRID_SYCL) || defined(GRID_CUDA) || defined(GRID_HIP)
     static deviceVector<RealD> alpha_p(1);
     static deviceVector<RealD> beta_p(1);
     // can prestore the 1 and the zero on device
     acceleratorCopyToDevice((void *)&alpha,(void *)&alpha_p[0],sizeof(RealD));
     acceleratorCopyToDevice((void *)&beta ,(void *)&beta_p[0],sizeof(RealD));
+#endif
     RealD t0=usecond();
 
     assert(Bkn.size()==batchCount);
@@ -661,20 +807,7 @@ public:
     synchronise();
 #endif
 #if !defined(GRID_SYCL) && !defined(GRID_CUDA) && !defined(GRID_HIP)
-    int sda = lda*k;
-    int sdb = ldb*k;
-    int sdc = ldc*n;
-    // Need a default/reference implementation
-    for (int p = 0; p < batchCount; ++p) {
-      for (int mm = 0; mm < m; ++mm) {
-	for (int nn = 0; nn < n; ++nn) {
-	  RealD c_mn(0.0);
-	  for (int kk = 0; kk < k; ++kk)
-	    c_mn += Amk[p][mm + kk*lda ] * Bkn[p][kk + nn*ldb];
-	  Cmn[p][mm + nn*ldc] =  (alpha)*c_mn + (beta)*Cmn[p][mm + nn*ldc ];
-	}
-      }
-    }
+    gemmBatchedHost(OpA,OpB,m,n,k,alpha,Amk,Bkn,beta,Cmn);
 #endif
      RealD t1=usecond();
      RealD flops = 2.0*m*n*k*batchCount;
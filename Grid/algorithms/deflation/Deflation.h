@@ -75,11 +75,11 @@ public:
 
   virtual void operator()(const Field &src,Field &guess) {
     guess = Zero();
-    for (int i=0;i<N;i++) {
-      const Field& tmp = evec[i];
-      axpy(guess,TensorRemove(innerProduct(tmp,src)) / eval[i],tmp,guess);
-    }
     guess.Checkerboard() = src.Checkerboard();
+    std::vector<ComplexD> ip(N);
+    basisInnerProducts(ip,evec,0,N,src);
+    for (int i=0;i<N;i++) ip[i] = ip[i] / eval[i];
+    basisMultiAxpy(guess,ip,evec,0,N);
   }
 };
 
@@ -106,10 +106,10 @@ public:
     CoarseField src_coarse(evec_coarse[0].Grid());
     CoarseField guess_coarse(evec_coarse[0].Grid());    guess_coarse = Zero();
     blockProject(src_coarse,src,subspace);    
-    for (int i=0;i<N;i++) {
-      const CoarseField & tmp = evec_coarse[i];
-      axpy(guess_coarse,TensorRemove(innerProduct(tmp,src_coarse)) / eval_coarse[i],tmp,guess_coarse);
-    }
+    std::vector<ComplexD> ip(N);
+    basisInnerProducts(ip,evec_coarse,0,N,src_coarse);
+    for (int i=0;i<N;i++) ip[i] = ip[i] / eval_coarse[i];
+    basisMultiAxpy(guess_coarse,ip,evec_coarse,0,N);
     blockPromote(guess_coarse,guess,subspace);
     guess.Checkerboard() = src.Checkerboard();
   };
@@ -76,16 +76,21 @@ class BiCGSTAB : public OperatorFunction<Field>
       p = Zero();
 
       // Initial residual computation & set up
-      RealD guess = norm2(psi);
-      assert(std::isnan(guess) == 0);
-    
       Linop.Op(psi, v);
-      b = norm2(v);
 
       r = src - v;
       rhat = r;
-      a = norm2(r);
-      ssq = norm2(src);
+
+      ReductionQueue norms(src.Grid());
+      auto guess_h = norms.norm2(psi);
+      auto b_h     = norms.norm2(v);
+      auto a_h     = norms.norm2(r);
+      auto ssq_h   = norms.norm2(src);
+      RealD guess = guess_h;
+      assert(std::isnan(guess) == 0);
+      b   = b_h;
+      a   = a_h;
+      ssq = ssq_h;
 
       std::cout << GridLogIterative << std::setprecision(8) << "BiCGSTAB: guess " << guess << std::endl;
       std::cout << GridLogIterative << std::setprecision(8) << "BiCGSTAB:   src " << ssq << std::endl;
@@ -167,9 +172,13 @@ class BiCGSTAB : public OperatorFunction<Field>
 
         LinalgTimer.Start();
         InnerTimer.Start();
-        ComplexD Comega = innerProduct(t,s);
+        // <t,s> and |t|^2 share one global sum
+        ReductionQueue omega_q(t.Grid());
+        auto Comega_h = omega_q.innerProduct(t,s);
+        auto tt_h     = omega_q.norm2(t);
+        ComplexD Comega = Comega_h;
         InnerTimer.Stop();
-        omega = Comega.real() / norm2(t);
+        omega = Comega.real() / tt_h.get();
 
         LinearCombTimer.Start();
 	{
@@ -197,8 +206,11 @@ class BiCGSTAB : public OperatorFunction<Field>
           Linop.Op(psi, v);
           p = v - src;
 
-          RealD srcnorm = sqrt(norm2(src));
-          RealD resnorm = sqrt(norm2(p));
+          ReductionQueue true_norms(src.Grid());
+          auto srcnorm_h = true_norms.norm2(src);
+          auto resnorm_h = true_norms.norm2(p);
+          RealD srcnorm = sqrt(srcnorm_h.get());
+          RealD resnorm = sqrt(resnorm_h.get());
           RealD true_residual = resnorm / srcnorm;
 
           std::cout << GridLogMessage << "BiCGSTAB Converged on iteration " << k << std::endl;
@@ -75,8 +75,11 @@ public:
     Field r(src.Grid());
 
     // Initial residual computation & set up
-    ssq = norm2(src);
-    RealD guess = norm2(psi);
+    ReductionQueue norms(src.Grid());
+    auto ssq_h   = norms.norm2(src);
+    auto guess_h = norms.norm2(psi);
+    ssq = ssq_h;
+    RealD guess = guess_h;
     assert(std::isnan(guess) == 0);
     if ( guess == 0.0 ) {
       r = src;
@@ -183,8 +186,11 @@ public:
 	GridBase *grid = src.Grid();
 	RealD DwfFlops = (1452. )*grid->gSites()*4*k
    	               + (8+4+8+4+4)*12*grid->gSites()*k; // CG linear algebra
-        RealD srcnorm = std::sqrt(norm2(src));
-        RealD resnorm = std::sqrt(norm2(p));
+        ReductionQueue true_norms(grid);
+        auto srcnorm_h = true_norms.norm2(src);
+        auto resnorm_h = true_norms.norm2(p);
+        RealD srcnorm = std::sqrt(srcnorm_h.get());
+        RealD resnorm = std::sqrt(resnorm_h.get());
         RealD true_residual = resnorm / srcnorm;
         std::cout << GridLogMessage << "ConjugateGradient Converged on iteration " << k 
 		  << "\tComputed residual " << std::sqrt(cp / ssq)
@@ -205,6 +211,7 @@ public:
         if (ErrorOnNoConverge) assert(true_residual / Tolerance < 10000.0);
 
 	IterationsToComplete = k;	
+	SolverLogIterations(k);
 	TrueResidual = true_residual;
 
         return;
@@ -230,6 +237,7 @@ public:
 
     if (ErrorOnNoConverge) assert(0);
     IterationsToComplete = k;
+    SolverLogIterations(k);
 
   }
 };
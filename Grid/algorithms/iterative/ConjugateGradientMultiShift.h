@@ -330,6 +330,7 @@ public:
       std::cout << GridLogMessage << "\tShift    " << ShiftTimer.Elapsed()     <<std::endl;
 
       IterationsToComplete = k;	
+      SolverLogIterations(k);
 
 	return;
       }
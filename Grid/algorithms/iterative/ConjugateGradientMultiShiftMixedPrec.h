@@ -402,6 +402,7 @@ public:
 	std::cout << GridLogMessage << "\tSolver+Cleanup " << SolverTimer.Elapsed() + CleanupTimer.Elapsed() << std::endl;
 
 	IterationsToComplete = k;	
+	SolverLogIterations(k);
 
 	return;
       }
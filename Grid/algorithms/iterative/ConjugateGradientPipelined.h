@@ -0,0 +1,266 @@
+/*************************************************************************************
+
+Grid physics library, www.github.com/paboyle/Grid
+
+Source file: ./lib/algorithms/iterative/ConjugateGradientPipelined.h
+
+Copyright (C) 2015
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+See the full license in the file "LICENSE" in the top level distribution
+directory
+*************************************************************************************/
+			   /*  END LEGAL */
+#ifndef GRID_CONJUGATE_GRADIENT_PIPELINED_H
+#define GRID_CONJUGATE_GRADIENT_PIPELINED_H
+
+NAMESPACE_BEGIN(Grid);
+
+/////////////////////////////////////////////////////////////////////////////
+// Pipelined CG (Ghysels and Vanroose, Parallel Computing 40 (2014) 224)
+//
+// Carries w = A r, s = A p, z = A s alongside the usual vectors, so the two
+// inner products (r,r) and (r,w) of an iteration are known before the
+// matrix multiply. They are reduced locally in the same sweep as the vector
+// updates, and the global sum is started non-blocking and overlapped with
+// q = A w. One reduction latency per iteration, hidden behind the Dslash.
+//
+// The extra recurrences drift from the true residual faster than in plain
+// CG; every ReplaceInterval iterations r, w, s and z are recomputed from x
+// and p (three extra matrix multiplies).
+/////////////////////////////////////////////////////////////////////////////
+template <class Field>
+class ConjugateGradientPipelined : public OperatorFunction<Field> {
+public:
+
+  using OperatorFunction<Field>::operator();
+
+  bool ErrorOnNoConverge;  // throw an assert when the CG fails to converge.
+                           // Defaults true.
+  RealD Tolerance;
+  Integer MaxIterations;
+  Integer ReplaceInterval;      // Residual replacement period; 0 disables
+  Integer IterationsToComplete; //Number of iterations the CG took to finish. Filled in upon completion
+  RealD TrueResidual;
+
+  ConjugateGradientPipelined(RealD tol, Integer maxit, bool err_on_no_conv = true, Integer replace = 100)
+    : ErrorOnNoConverge(err_on_no_conv),
+      Tolerance(tol),
+      MaxIterations(maxit),
+      ReplaceInterval(replace)
+  {};
+
+  // Rank local (r,r) and (r,w); summed over ranks by the caller
+  void LocalDots(const Field &r, const Field &w, ComplexD *dots)
+  {
+    dots[0] = rankInnerProduct(r,r);
+    dots[1] = rankInnerProduct(r,w);
+  }
+
+  void operator()(LinearOperatorBase<Field> &Linop, const Field &src, Field &psi) {
+
+    GRID_TRACE("ConjugateGradientPipelined");
+    GridStopWatch PreambleTimer;
+    PreambleTimer.Start();
+    psi.Checkerboard() = src.Checkerboard();
+
+    conformable(psi, src);
+
+    GridBase *grid = src.Grid();
+
+    RealD alpha, beta, gamma, delta, gamma_old, alpha_old, ssq, d, qq;
+
+    Field r(grid);
+    Field w(grid);
+    Field q(grid);
+    Field p(grid);
+    Field s(grid);
+    Field z(grid);
+
+    ssq = norm2(src);
+    RealD guess = norm2(psi);
+    assert(std::isnan(guess) == 0);
+
+    // Handle trivial case of zero src
+    if (ssq == 0.){
+      psi = Zero();
+      IterationsToComplete = 1;
+      TrueResidual = 0.;
+      return;
+    }
+
+    if ( guess == 0.0 ) {
+      r = src;
+    } else {
+      Linop.HermOp(psi, q);
+      r = src - q;
+    }
+    Linop.HermOp(r, w);
+    p = Zero();
+    s = Zero();
+    z = Zero();
+    p.Checkerboard() = s.Checkerboard() = z.Checkerboard() = src.Checkerboard();
+
+    RealD rsq = Tolerance * Tolerance * ssq;
+
+    std::cout << GridLogIterative << std::setprecision(8) << "ConjugateGradientPipelined: guess " << guess << std::endl;
+    std::cout << GridLogIterative << std::setprecision(8) << "ConjugateGradientPipelined:   src " << ssq << std::endl;
+
+    PreambleTimer.Stop();
+    GridStopWatch LinalgTimer;
+    GridStopWatch MatrixTimer;
+    GridStopWatch ReduceWaitTimer;
+    GridStopWatch ReplaceTimer;
+    GridStopWatch SolverTimer;
+
+    const uint64_t sites = grid->oSites();
+    typedef typename Field::vector_object vobj;
+    typedef decltype(innerProduct(vobj(),vobj())) inner_t;
+    deviceVector<inner_t> rr_tmp(sites);
+    deviceVector<inner_t> rw_tmp(sites);
+    auto rr_tmp_v = &rr_tmp[0];
+    auto rw_tmp_v = &rw_tmp[0];
+
+    ComplexD dots[2];
+    LocalDots(r, w, dots);
+
+    alpha = 0.0;
+    gamma = 0.0;
+
+    SolverTimer.Start();
+    int k;
+    for (k = 0; k <= MaxIterations; k++) {
+
+      GridStopWatch IterationTimer;
+      IterationTimer.Start();
+
+      // Global (r,r), (r,w) in flight while q = A w
+      CommsRequest_t request;
+      grid->GlobalSumVectorBegin(dots, 2, request);
+
+      MatrixTimer.Start();
+      Linop.HermOp(w, q);
+      MatrixTimer.Stop();
+
+      ReduceWaitTimer.Start();
+      grid->GlobalSumVectorComplete(request);
+      ReduceWaitTimer.Stop();
+
+      gamma_old = gamma;
+      alpha_old = alpha;
+      gamma = real(dots[0]);
+      delta = real(dots[1]);
+
+      if ( (k % 500) == 0 ) {
+	std::cout << GridLogMessage << "ConjugateGradientPipelined: Iteration " << k
+		  << " residual " << sqrt(gamma/ssq) << " target " << Tolerance << std::endl;
+      } else {
+	std::cout << GridLogIterative << "ConjugateGradientPipelined: Iteration " << k
+		  << " residual " << sqrt(gamma/ssq) << " target " << Tolerance << std::endl;
+      }
+
+      // Stopping condition on the residual of the current psi
+      if (gamma <= rsq) break;
+      if (k == MaxIterations) break;
+
+      if ( k == 0 ) {
+	beta  = 0.0;
+	alpha = gamma / delta;
+      } else {
+	beta  = gamma / gamma_old;
+	alpha = gamma / (delta - beta * gamma / alpha_old);
+      }
+
+      LinalgTimer.Start();
+      {
+	autoView( psi_v , psi, AcceleratorWrite);
+	autoView( r_v   , r,   AcceleratorWrite);
+	autoView( w_v   , w,   AcceleratorWrite);
+	autoView( p_v   , p,   AcceleratorWrite);
+	autoView( s_v   , s,   AcceleratorWrite);
+	autoView( z_v   , z,   AcceleratorWrite);
+	autoView( q_v   , q,   AcceleratorRead);
+	accelerator_for(ss, sites, vobj::Nsimd(), {
+	    auto z_s = q_v(ss) + beta * z_v(ss);
+	    auto s_s = w_v(ss) + beta * s_v(ss);
+	    auto p_s = r_v(ss) + beta * p_v(ss);
+	    auto r_s = r_v(ss) - alpha * s_s;
+	    auto w_s = w_v(ss) - alpha * z_s;
+	    coalescedWrite(psi_v[ss], psi_v(ss) + alpha * p_s);
+	    coalescedWrite(z_v[ss], z_s);
+	    coalescedWrite(s_v[ss], s_s);
+	    coalescedWrite(p_v[ss], p_s);
+	    coalescedWrite(r_v[ss], r_s);
+	    coalescedWrite(w_v[ss], w_s);
+	    coalescedWrite(rr_tmp_v[ss], innerProduct(r_s, r_s));
+	    coalescedWrite(rw_tmp_v[ss], innerProduct(r_s, w_s));
+	});
+      }
+      dots[0] = TensorRemove(sumD(rr_tmp_v, sites));
+      dots[1] = TensorRemove(sumD(rw_tmp_v, sites));
+      LinalgTimer.Stop();
+
+      // Residual replacement
+      if ( ReplaceInterval && ((k+1) % ReplaceInterval == 0) ) {
+	ReplaceTimer.Start();
+	Linop.HermOp(psi, q);
+	r = src - q;
+	Linop.HermOp(r, w);
+	Linop.HermOp(p, s);
+	Linop.HermOp(s, z);
+	LocalDots(r, w, dots);
+	ReplaceTimer.Stop();
+      }
+
+      IterationTimer.Stop();
+    }
+    SolverTimer.Stop();
+
+    Linop.HermOpAndNorm(psi, q, d, qq);
+    p = q - src;
+    RealD srcnorm = std::sqrt(ssq);
+    RealD resnorm = std::sqrt(norm2(p));
+    RealD true_residual = resnorm / srcnorm;
+    TrueResidual = true_residual;
+    IterationsToComplete = k;
+    SolverLogIterations(k);
+
+    if ( gamma <= rsq ) {
+      std::cout << GridLogMessage << "ConjugateGradientPipelined Converged on iteration " << k
+		<< "\tComputed residual " << std::sqrt(gamma / ssq)
+		<< "\tTrue residual " << true_residual
+		<< "\tTarget " << Tolerance << std::endl;
+    } else {
+      std::cout << GridLogMessage << "ConjugateGradientPipelined did NOT converge " << k << " / " << MaxIterations
+		<< " residual " << std::sqrt(gamma / ssq) << std::endl;
+    }
+
+    std::cout << GridLogMessage << "\tSolver Elapsed    " << SolverTimer.Elapsed() <<std::endl;
+    std::cout << GridLogPerformance << "Time breakdown "<<std::endl;
+    std::cout << GridLogPerformance << "\tMatrix     " << MatrixTimer.Elapsed() <<std::endl;
+    std::cout << GridLogPerformance << "\tLinalg     " << LinalgTimer.Elapsed() <<std::endl;
+    std::cout << GridLogPerformance << "\tReduceWait " << ReduceWaitTimer.Elapsed() <<std::endl;
+    std::cout << GridLogPerformance << "\tReplace    " << ReplaceTimer.Elapsed() <<std::endl;
+
+    if ( gamma <= rsq ) {
+      if (ErrorOnNoConverge) assert(true_residual / Tolerance < 10000.0);
+    } else {
+      if (ErrorOnNoConverge) assert(0);
+    }
+  }
+};
+NAMESPACE_END(Grid);
+#endif
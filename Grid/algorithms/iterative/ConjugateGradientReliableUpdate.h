@@ -207,6 +207,7 @@ public:
 
 	
 	IterationsToComplete = k;	
+	SolverLogIterations(k);
 	ReliableUpdatesPerformed = l;
 	  
 	if(DoFinalCleanup){
@@ -265,6 +266,7 @@ public:
       
     if (ErrorOnNoConverge) assert(0);
     IterationsToComplete = k;
+    SolverLogIterations(k);
     ReliableUpdatesPerformed = l;      
   }    
 };
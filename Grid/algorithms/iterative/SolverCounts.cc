@@ -0,0 +1,50 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid 
+
+    Source file: ./lib/algorithms/iterative/SolverCounts.cc
+
+    Copyright (C) 2015
+
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/GridCore.h>
+
+NAMESPACE_BEGIN(Grid);
+
+uint64_t SolverSolveCount;
+uint64_t SolverIterationCount;
+
+void SolverResetCounts(void)
+{
+  SolverSolveCount=0;
+  SolverIterationCount=0;
+}
+void SolverGetCounts(uint64_t &solves,uint64_t &iterations)
+{
+  solves     = SolverSolveCount;
+  iterations = SolverIterationCount;
+}
+void SolverLogIterations(uint64_t iterations)
+{
+  SolverSolveCount++;
+  SolverIterationCount+=iterations;
+}
+
+NAMESPACE_END(Grid);
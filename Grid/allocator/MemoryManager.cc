@@ -1,4 +1,7 @@
 #include <Grid/GridCore.h>
+#include <sys/mman.h>
+#include <atomic>
+#include <mutex>
 
 NAMESPACE_BEGIN(Grid);
 
@@ -16,6 +19,7 @@ NAMESPACE_BEGIN(Grid);
 uint64_t total_shared;
 uint64_t total_device;
 uint64_t total_host;;
+uint64_t total_host_max;
 
 #if defined(__has_feature)
 #if __has_feature(leak_sanitizer)
@@ -62,6 +66,7 @@ void MemoryManager::PrintBytes(void)
   std::cout << " MemoryManager : "<<(total_shared>>20)<<" shared      Mbytes "<<std::endl;
   std::cout << " MemoryManager : "<<(total_device>>20)<<" accelerator Mbytes "<<std::endl;
   std::cout << " MemoryManager : "<<(total_host>>20)  <<" cpu         Mbytes "<<std::endl;
+  std::cout << " MemoryManager : "<<(total_host_max>>20)<<" cpu peak    Mbytes "<<std::endl;
   uint64_t cacheBytes;
   cacheBytes = CacheBytes[Cpu];
   std::cout << " MemoryManager : "<<(cacheBytes>>20) <<" cpu cache Mbytes "<<std::endl;
@@ -69,6 +74,14 @@ void MemoryManager::PrintBytes(void)
   std::cout << " MemoryManager : "<<(cacheBytes>>20) <<" acc cache Mbytes "<<std::endl;
   cacheBytes = CacheBytes[Shared];
   std::cout << " MemoryManager : "<<(cacheBytes>>20) <<" shared cache Mbytes "<<std::endl;
+  if ( HostPoolEnabled ) {
+    MemoryStatus stat;
+    HostPoolFootprint(stat);
+    std::cout << " MemoryManager : "<<(stat.HostPoolFreeBytes>>20)<<" cpu pool free Mbytes "<<std::endl;
+    std::cout << " MemoryManager : "<<(stat.HostPoolWasteBytes>>20)<<" cpu pool rounding Mbytes "<<std::endl;
+    std::cout << " MemoryManager : "<<(stat.HostPoolHighWaterBytes>>20)<<" cpu pool peak Mbytes "<<std::endl;
+    std::cout << " MemoryManager : cpu pool hits "<<stat.HostPoolHits<<" misses "<<stat.HostPoolMisses<<std::endl;
+  }
   
 #ifdef GRID_CUDA
   cuda_mem();
@@ -143,6 +156,7 @@ void  MemoryManager::SharedFree    (void *ptr,size_t bytes)
 void *MemoryManager::CpuAllocate(size_t bytes)
 {
   total_host+=bytes;
+  if ( total_host > total_host_max ) total_host_max = total_host;
   void *ptr = (void *) Lookup(bytes,Cpu);
   if ( ptr == (void *) NULL ) {
     ptr = (void *) acceleratorAllocShared(bytes);
@@ -170,9 +184,16 @@ void  MemoryManager::CpuFree    (void *_ptr,size_t bytes)
 void *MemoryManager::CpuAllocate(size_t bytes)
 {
   total_host+=bytes;
-  void *ptr = (void *) Lookup(bytes,Cpu);
-  if ( ptr == (void *) NULL ) {
-    ptr = (void *) acceleratorAllocCpu(bytes);
+  if ( total_host > total_host_max ) total_host_max = total_host;
+  void *ptr;
+  size_t class_bytes;
+  if ( HostPoolEnabled && (HostPoolClass(bytes,class_bytes)>=0) ) {
+    ptr = HostPoolAllocate(bytes);
+  } else { 
+    ptr = (void *) Lookup(bytes,Cpu);
+    if ( ptr == (void *) NULL ) {
+      ptr = (void *) acceleratorAllocCpu(bytes);
+    }
   }
 #ifdef GRID_MM_VERBOSE
   std::cout <<"CpuAllocate "<<std::endl;
@@ -184,9 +205,14 @@ void  MemoryManager::CpuFree    (void *_ptr,size_t bytes)
 {
   total_host-=bytes;
   NotifyDeletion(_ptr);
-  void *__freeme = Insert(_ptr,bytes,Cpu);
-  if ( __freeme ) { 
-    acceleratorFreeCpu(__freeme);
+  size_t class_bytes;
+  if ( HostPoolEnabled && (HostPoolClass(bytes,class_bytes)>=0) ) {
+    HostPoolFree(_ptr,bytes);
+  } else {
+    void *__freeme = Insert(_ptr,bytes,Cpu);
+    if ( __freeme ) { 
+      acceleratorFreeCpu(__freeme);
+    }
   }
 #ifdef GRID_MM_VERBOSE
   std::cout <<"CpuFree "<<std::endl;
@@ -234,6 +260,16 @@ void MemoryManager::Init(void)
     }
   }
 
+  ////////////////////////////////////////////////////////////////////
+  // The pool can only take over before the first host allocation,
+  // as CpuFree routes by size and must see the same decision.
+  // Unified memory keeps the host path on shared allocations.
+  ////////////////////////////////////////////////////////////////////
+#ifndef GRID_UVM
+  if ( (HostPoolMaxBytes>0) && (total_host==0) && (total_host_max==0) ) {
+    HostPoolEnabled = 1;
+  }
+#endif
 }
 
 void MemoryManager::InitMessage(void) {
@@ -249,6 +285,15 @@ void MemoryManager::InitMessage(void) {
   std::cout << GridLogMessage<< "MemoryManager::Init() cache pool for recent shared allocations: SMALL "<<Ncache[SharedSmall]<<" LARGE "<<Ncache[Shared]<<" Huge "<<Ncache[SharedHuge]<<std::endl;
 #endif
   
+  if ( HostPoolEnabled ) {
+    std::cout << GridLogMessage<< "MemoryManager::Init() size class pool for host allocations holding up to "<<(HostPoolMaxBytes>>20)<<" MB";
+    if ( HostPoolHugePages==1 ) std::cout << " on transparent huge pages";
+    if ( HostPoolHugePages==2 ) std::cout << " on explicit huge pages";
+    std::cout <<std::endl;
+  } else if ( HostPoolMaxBytes>0 ) {
+    std::cout << GridLogWarning<< "MemoryManager::Init() host pool requested but not available; using allocation cache"<<std::endl;
+  }
+
 #ifdef GRID_UVM
   std::cout << GridLogMessage<< "MemoryManager::Init() Unified memory space"<<std::endl;
 #ifdef GRID_CUDA
@@ -358,5 +403,188 @@ void *MemoryManager::Lookup(size_t bytes,AllocationCacheEntry *entries,int ncach
 }
 
 
+//////////////////////////////////////////////////////////////////////
+// Size class pool for host allocations.
+//
+// Classes have eight steps per octave from GRID_ALLOC_SMALL_LIMIT up to
+// GRID_ALLOC_HUGE_LIMIT, so a block is at most 1/8 larger than asked.
+// Freed blocks go to a per-thread free list of bounded depth, overflow
+// to a shared depot, and are released only when the bytes held free
+// would exceed HostPoolMaxBytes. Fresh blocks are first touched with
+// thread_for, with the same static decomposition the site loops use, so
+// each thread's pages land in its own NUMA domain.
+//////////////////////////////////////////////////////////////////////
+#define GRID_POOL_STEPS     (8)
+#define GRID_POOL_CLASSES   (8*32)
+#define GRID_POOL_DEPTH     (4)
+#define GRID_POOL_PAGE      (4096)
+#define GRID_POOL_HUGE_PAGE (2*1024*1024)
+
+int      MemoryManager::HostPoolEnabled;
+uint64_t MemoryManager::HostPoolMaxBytes;
+int      MemoryManager::HostPoolHugePages;
+
+static std::atomic<uint64_t> pool_hits;
+static std::atomic<uint64_t> pool_misses;
+static std::atomic<uint64_t> pool_free_bytes;
+static std::atomic<uint64_t> pool_live_bytes;
+static std::atomic<uint64_t> pool_waste_bytes;
+static std::atomic<uint64_t> pool_high_water;
+
+struct HostPoolDepot {
+  std::mutex lock;
+  std::vector<void *> blocks[GRID_POOL_CLASSES];
+};
+static HostPoolDepot pool_depot;
+
+struct HostPoolThreadCache {
+  std::vector<void *> blocks[GRID_POOL_CLASSES];
+  // Hand cached blocks to the depot when the thread exits
+  ~HostPoolThreadCache() {
+    std::lock_guard<std::mutex> guard(pool_depot.lock);
+    for(int c=0;c<GRID_POOL_CLASSES;c++){
+      for(auto b : blocks[c]) pool_depot.blocks[c].push_back(b);
+    }
+  }
+};
+static thread_local HostPoolThreadCache pool_cache;
+
+int MemoryManager::HostPoolClass(size_t bytes,size_t &class_bytes)
+{
+  if ( (bytes < GRID_ALLOC_SMALL_LIMIT) || (bytes >= GRID_ALLOC_HUGE_LIMIT) ) return -1;
+  int e = 63 - __builtin_clzll((unsigned long long)bytes);
+  size_t base = 1ULL<<e;
+  size_t step = base/GRID_POOL_STEPS;
+  size_t q    = (bytes - base + step - 1)/step;
+  class_bytes = base + q*step;
+  if ( q == GRID_POOL_STEPS ) { e++; q=0; }
+  int e0 = 63 - __builtin_clzll((unsigned long long)GRID_ALLOC_SMALL_LIMIT);
+  int c  = (e-e0)*GRID_POOL_STEPS + q;
+  assert(c < GRID_POOL_CLASSES);
+  return c;
+}
+
+// Explicit huge pages are mapped in whole huge pages; smaller classes,
+// and mappings the kernel refuses, fall back to ordinary pages.
+static size_t HostPoolMapBytes(size_t class_bytes)
+{
+  if ( (MemoryManager::HostPoolHugePages==2) && (class_bytes >= GRID_POOL_HUGE_PAGE) ) {
+    return ((class_bytes + GRID_POOL_HUGE_PAGE - 1)/GRID_POOL_HUGE_PAGE)*GRID_POOL_HUGE_PAGE;
+  }
+  return class_bytes;
+}
+
+static void *HostPoolFresh(size_t class_bytes)
+{
+  void *ptr = NULL;
+  int huge  = (class_bytes >= GRID_POOL_HUGE_PAGE) ? MemoryManager::HostPoolHugePages : 0;
+  if ( huge==2 ) {
+    size_t map_bytes = HostPoolMapBytes(class_bytes);
+    int flags = MAP_PRIVATE|MAP_ANONYMOUS;
+#ifdef MAP_HUGETLB
+    ptr = mmap(NULL,map_bytes,PROT_READ|PROT_WRITE,flags|MAP_HUGETLB,-1,0);
+    if ( ptr == MAP_FAILED ) ptr = NULL;
+#endif
+    if ( ptr == NULL ) {
+      ptr = mmap(NULL,map_bytes,PROT_READ|PROT_WRITE,flags,-1,0);
+      if ( ptr == MAP_FAILED ) ptr = NULL;
+    }
+  } else if ( huge==1 ) {
+    if ( posix_memalign(&ptr,GRID_POOL_HUGE_PAGE,class_bytes) ) ptr = NULL;
+#ifdef MADV_HUGEPAGE
+    if ( ptr ) madvise(ptr,class_bytes,MADV_HUGEPAGE);
+#endif
+  } else {
+    ptr = acceleratorAllocCpu(class_bytes);
+  }
+  if ( ptr == NULL ) return ptr;
+
+  // First touch: page p is written by the thread that owns it in thread_for
+  char *c = (char *)ptr;
+  uint64_t npage = (class_bytes + GRID_POOL_PAGE - 1)/GRID_POOL_PAGE;
+  thread_for(p,npage,{
+    c[p*GRID_POOL_PAGE] = 0;
+  });
+  return ptr;
+}
+
+static void HostPoolRelease(void *ptr,size_t class_bytes)
+{
+  int huge  = (class_bytes >= GRID_POOL_HUGE_PAGE) ? MemoryManager::HostPoolHugePages : 0;
+  if ( huge==2 )      munmap(ptr,HostPoolMapBytes(class_bytes));
+  else if ( huge==1 ) free(ptr);
+  else                acceleratorFreeCpu(ptr);
+}
+
+void *MemoryManager::HostPoolAllocate(size_t bytes)
+{
+  size_t class_bytes;
+  int c = HostPoolClass(bytes,class_bytes);
+  void *ptr = NULL;
+
+  std::vector<void *> &mine = pool_cache.blocks[c];
+  if ( mine.size() ) {
+    ptr = mine.back();
+    mine.pop_back();
+  } else {
+    std::lock_guard<std::mutex> guard(pool_depot.lock);
+    std::vector<void *> &depot = pool_depot.blocks[c];
+    if ( depot.size() ) {
+      ptr = depot.back();
+      depot.pop_back();
+    }
+  }
+
+  if ( ptr ) {
+    pool_hits++;
+    pool_free_bytes -= class_bytes;
+  } else {
+    pool_misses++;
+    ptr = HostPoolFresh(class_bytes);
+    if ( ptr == NULL ) return ptr;
+  }
+  pool_live_bytes  += class_bytes;
+  pool_waste_bytes += class_bytes - bytes;
+
+  uint64_t held = pool_live_bytes + pool_free_bytes;
+  uint64_t peak = pool_high_water;
+  while ( (held > peak) && !pool_high_water.compare_exchange_weak(peak,held) ) {};
+
+  return ptr;
+}
+
+void MemoryManager::HostPoolFree(void *ptr,size_t bytes)
+{
+  size_t class_bytes;
+  int c = HostPoolClass(bytes,class_bytes);
+  pool_live_bytes  -= class_bytes;
+  pool_waste_bytes -= class_bytes - bytes;
+
+  if ( pool_free_bytes + class_bytes > HostPoolMaxBytes ) {
+    HostPoolRelease(ptr,class_bytes);
+    return;
+  }
+  pool_free_bytes += class_bytes;
+
+  std::vector<void *> &mine = pool_cache.blocks[c];
+  if ( mine.size() < GRID_POOL_DEPTH ) {
+    mine.push_back(ptr);
+  } else {
+    std::lock_guard<std::mutex> guard(pool_depot.lock);
+    pool_depot.blocks[c].push_back(ptr);
+  }
+}
+
+void MemoryManager::HostPoolFootprint(MemoryStatus &stat)
+{
+  stat.HostBytes              = total_host;
+  stat.HostHighWaterBytes     = total_host_max;
+  stat.HostPoolHits           = pool_hits;
+  stat.HostPoolMisses         = pool_misses;
+  stat.HostPoolFreeBytes      = pool_free_bytes;
+  stat.HostPoolWasteBytes     = pool_waste_bytes;
+  stat.HostPoolHighWaterBytes = pool_high_water;
+}
+
 NAMESPACE_END(Grid);
 
@@ -83,6 +83,13 @@ struct MemoryStatus {
   uint64_t     DeviceDestroy;
   uint64_t     DeviceAllocCacheBytes;
   uint64_t     HostAllocCacheBytes;
+  uint64_t     HostBytes;
+  uint64_t     HostHighWaterBytes;
+  uint64_t     HostPoolHits;
+  uint64_t     HostPoolMisses;
+  uint64_t     HostPoolFreeBytes;      // held in the pool's free lists
+  uint64_t     HostPoolWasteBytes;     // size class rounding of live blocks
+  uint64_t     HostPoolHighWaterBytes; // peak of live plus free pool bytes
 };
 
 
@@ -113,6 +120,16 @@ private:
   static void *Insert(void *ptr,size_t bytes,AllocationCacheEntry *entries,int ncache,int &victim,uint64_t &cbytes) ;
   static void *Lookup(size_t bytes,AllocationCacheEntry *entries,int ncache,uint64_t &cbytes) ;
 
+  /////////////////////////////////////////////////
+  // Size class pool for host allocations between
+  // GRID_ALLOC_SMALL_LIMIT and GRID_ALLOC_HUGE_LIMIT
+  /////////////////////////////////////////////////
+  static int   HostPoolEnabled;
+  static int   HostPoolClass(size_t bytes,size_t &class_bytes);
+  static void *HostPoolAllocate(size_t bytes);
+  static void  HostPoolFree(void *ptr,size_t bytes);
+  static void  HostPoolFootprint(MemoryStatus &stat);
+
  public:
   static void PrintBytes(void);
   static void Audit(std::string s);
@@ -137,6 +154,9 @@ private:
   static uint64_t     DeviceToHostXfer;
   static uint64_t     DeviceEvictions;
   static uint64_t     DeviceDestroy;
+
+  static uint64_t     HostPoolMaxBytes;  // cap on bytes held free; 0 disables the pool
+  static int          HostPoolHugePages; // 0 none, 1 transparent, 2 explicit (MAP_HUGETLB)
   
   static uint64_t     DeviceCacheBytes();
   static uint64_t     HostCacheBytes();
@@ -154,6 +174,7 @@ private:
     stat.DeviceDestroy     = DeviceDestroy;
     stat.DeviceAllocCacheBytes = DeviceCacheBytes();
     stat.HostAllocCacheBytes   = HostCacheBytes();
+    HostPoolFootprint(stat);
     return stat;
   };
   
@@ -73,6 +73,10 @@ void CartesianCommunicator::GlobalSumVector(ComplexD *c,int N)
 {
   GlobalSumVector((double *)c,2*N);
 }
+void CartesianCommunicator::GlobalSumVectorBegin(ComplexD *c,int N,CommsRequest_t &request)
+{
+  GlobalSumVectorBegin((double *)c,2*N,request);
+}
   
 NAMESPACE_END(Grid);
 
@@ -114,6 +114,7 @@ public:
   ////////////////////////////////////////////////////////////
   void GlobalMax(RealD &);
   void GlobalMax(RealF &);
+  void GlobalMaxVector(RealD *,int N);
   void GlobalSum(RealF &);
   void GlobalSumVector(RealF *,int N);
   void GlobalSum(RealD &);
@@ -127,6 +128,14 @@ public:
   void GlobalSumVector(ComplexD *c,int N);
   void GlobalXOR(uint32_t &);
   void GlobalXOR(uint64_t &);
+
+  ////////////////////////////////////////////////////////////
+  // Non-blocking in place reduction; the buffer must not be
+  // read or written until GlobalSumVectorComplete returns
+  ////////////////////////////////////////////////////////////
+  void GlobalSumVectorBegin(RealD *,int N,CommsRequest_t &request);
+  void GlobalSumVectorBegin(ComplexD *c,int N,CommsRequest_t &request);
+  void GlobalSumVectorComplete(CommsRequest_t &request);
   
   template<class obj> void GlobalSum(obj &o){
     typedef typename obj::scalar_type scalar_type;
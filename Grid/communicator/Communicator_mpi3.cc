@@ -287,6 +287,11 @@ void CartesianCommunicator::GlobalMax(double &d)
   int ierr = MPI_Allreduce(MPI_IN_PLACE,&d,1,MPI_DOUBLE,MPI_MAX,communicator);
   assert(ierr==0);
 }
+void CartesianCommunicator::GlobalMaxVector(double *d,int N)
+{
+  int ierr = MPI_Allreduce(MPI_IN_PLACE,d,N,MPI_DOUBLE,MPI_MAX,communicator);
+  assert(ierr==0);
+}
 void CartesianCommunicator::GlobalSum(float &f){
   int ierr=MPI_Allreduce(MPI_IN_PLACE,&f,1,MPI_FLOAT,MPI_SUM,communicator);
   assert(ierr==0);
@@ -306,6 +311,17 @@ void CartesianCommunicator::GlobalSumVector(double *d,int N)
   int ierr = MPI_Allreduce(MPI_IN_PLACE,d,N,MPI_DOUBLE,MPI_SUM,communicator);
   assert(ierr==0);
 }
+void CartesianCommunicator::GlobalSumVectorBegin(double *d,int N,CommsRequest_t &request)
+{
+  int ierr = MPI_Iallreduce(MPI_IN_PLACE,d,N,MPI_DOUBLE,MPI_SUM,communicator,&request);
+  assert(ierr==0);
+}
+void CartesianCommunicator::GlobalSumVectorComplete(CommsRequest_t &request)
+{
+  MPI_Status status;
+  int ierr = MPI_Wait(&request,&status);
+  assert(ierr==0);
+}
 
 void CartesianCommunicator::SendToRecvFromBegin(std::vector<CommsRequest_t> &list,
 						void *xmit,
@@ -71,10 +71,13 @@ CartesianCommunicator::~CartesianCommunicator(){}
 
 void CartesianCommunicator::GlobalMax(float &){}
 void CartesianCommunicator::GlobalMax(double &){}
+void CartesianCommunicator::GlobalMaxVector(double *,int N){}
 void CartesianCommunicator::GlobalSum(float &){}
 void CartesianCommunicator::GlobalSumVector(float *,int N){}
 void CartesianCommunicator::GlobalSum(double &){}
 void CartesianCommunicator::GlobalSumVector(double *,int N){}
+void CartesianCommunicator::GlobalSumVectorBegin(double *,int N,CommsRequest_t &request){}
+void CartesianCommunicator::GlobalSumVectorComplete(CommsRequest_t &request){}
 void CartesianCommunicator::GlobalSum(uint32_t &){}
 void CartesianCommunicator::GlobalSum(uint64_t &){}
 void CartesianCommunicator::GlobalSumVector(uint64_t *,int N){}
@@ -541,6 +541,225 @@ template<class vobj> void  Cshift_comms_simd(Lattice<vobj> &ret,const Lattice<vo
   */
 }
 #endif
+
+//////////////////////////////////////////////////////////////////////////////
+// Non-blocking Cshift
+//
+//   CshiftAsync<vobj> shift;
+//   shift.Begin(ret_mu,U_mu,mu,1);
+//   shift.Begin(ret_nu,U_nu,nu,-1);   // any number of fields/directions
+//   ... independent work ...
+//   shift.Complete();
+//
+// Begin gathers every off node plane of the shift into its own slot of a
+// send buffer and posts all the sends and receives at once, then copies the
+// on node planes while the messages are in flight; Complete waits and
+// scatters. ret must not be read, nor rhs modified, before Complete.
+// Unlike Cshift, buffers hold all the planes of all pending shifts.
+//////////////////////////////////////////////////////////////////////////////
+template<class vobj> class CshiftAsync {
+public:
+  typedef typename vobj::scalar_object scalar_object;
+
+private:
+  struct PlaneScatter {
+    Lattice<vobj> *ret;
+    int dimension;
+    int plane;
+    int cbmask;
+    int off;                                      // offset into recv buffer
+    cshiftVector<vobj> *buf;
+  };
+  struct PlaneMerge {
+    Lattice<vobj> *ret;
+    int dimension;
+    int plane;
+    int cbmask;
+    ExtractPointerArray<scalar_object> pointers;
+  };
+
+  std::vector<CommsRequest_t>   requests;
+  std::vector<PlaneScatter>     scatters;
+  std::vector<PlaneMerge>       merges;
+  std::list<cshiftVector<vobj> >          buffers;          // stable addresses
+  std::list<cshiftVector<scalar_object> > extract_buffers;
+  GridBase *grid=nullptr;
+  int tag=0;
+
+public:
+
+  ~CshiftAsync() { assert(requests.size()==0); }
+
+  void Begin(Lattice<vobj> &ret,const Lattice<vobj> &rhs,int dimension,int shift)
+  {
+    GridBase *g = rhs.Grid();
+    assert(grid==nullptr || grid==g);
+    grid = g;
+    assert(ret.Grid()==g);
+
+    int fd = g->_fdimensions[dimension];
+    shift = (shift+fd)%fd;
+    ret.Checkerboard() = g->CheckerBoardDestination(rhs.Checkerboard(),shift,dimension);
+
+    int comm_dim   = g->_processors[dimension] >1 ;
+    int splice_dim = g->_simd_layout[dimension]>1 && (comm_dim);
+
+    if ( !comm_dim ) {
+      Cshift_local(ret,rhs,dimension,shift);
+      return;
+    }
+
+    int sshift[2];
+    sshift[0] = g->CheckerBoardShiftForCB(rhs.Checkerboard(),dimension,shift,Even);
+    sshift[1] = g->CheckerBoardShiftForCB(rhs.Checkerboard(),dimension,shift,Odd);
+    if ( sshift[0] == sshift[1] ) {
+      if ( splice_dim ) BeginSimd(ret,rhs,dimension,shift,0x3);
+      else              BeginComms(ret,rhs,dimension,shift,0x3);
+    } else {
+      if ( splice_dim ) {
+	BeginSimd(ret,rhs,dimension,shift,0x1);
+	BeginSimd(ret,rhs,dimension,shift,0x2);
+      } else {
+	BeginComms(ret,rhs,dimension,shift,0x1);
+	BeginComms(ret,rhs,dimension,shift,0x2);
+      }
+    }
+  }
+
+  void Complete(void)
+  {
+    if ( grid ) grid->CommsComplete(requests);
+    for(auto &s : scatters){
+      Scatter_plane_simple(*s.ret,*s.buf,s.dimension,s.plane,s.cbmask,s.off);
+    }
+    for(auto &m : merges){
+      Scatter_plane_merge(*m.ret,m.pointers,m.dimension,m.plane,m.cbmask);
+    }
+    scatters.resize(0);
+    merges.resize(0);
+    buffers.clear();
+    extract_buffers.clear();
+    grid=nullptr;
+    tag=0;
+  }
+
+private:
+
+  void BeginComms(Lattice<vobj> &ret,const Lattice<vobj> &rhs,int dimension,int shift,int cbmask)
+  {
+    int rd = grid->_rdimensions[dimension];
+    int pd = grid->_processors[dimension];
+    assert(grid->_simd_layout[dimension]==1);
+
+    int buffer_size = grid->_slice_nblock[dimension]*grid->_slice_block[dimension];
+    int words = buffer_size;
+    if (cbmask != 0x3) words=words>>1;
+    int bytes = words * sizeof(vobj);
+
+    int cb     = (cbmask==0x2)? Odd : Even;
+    int sshift = grid->CheckerBoardShiftForCB(rhs.Checkerboard(),dimension,shift,cb);
+
+    int nremote=0;
+    for(int x=0;x<rd;x++){
+      if ( ((x+sshift)/rd)%pd ) nremote++;
+    }
+
+    buffers.emplace_back(nremote*buffer_size); cshiftVector<vobj> &send_buf = buffers.back();
+    buffers.emplace_back(nremote*buffer_size); cshiftVector<vobj> &recv_buf = buffers.back();
+
+    // Gather and post every off node plane
+    int slot=0;
+    for(int x=0;x<rd;x++){
+      int sx        =  (x+sshift)%rd;
+      int comm_proc = ((x+sshift)/rd)%pd;
+      if ( comm_proc ) {
+	int xmit_to_rank;
+	int recv_from_rank;
+	grid->ShiftedRanks(dimension,comm_proc,xmit_to_rank,recv_from_rank);
+
+	int off = slot*buffer_size;
+	Gather_plane_simple (rhs,send_buf,dimension,sx,cbmask,off);
+	grid->SendToRecvFromBegin(requests,
+				  (void *)&send_buf[off],xmit_to_rank,
+				  (void *)&recv_buf[off],recv_from_rank,
+				  bytes,NextTag());
+	scatters.push_back({&ret,dimension,x,cbmask,off,&recv_buf});
+	slot++;
+      }
+    }
+
+    // Interior planes overlap with the comms
+    for(int x=0;x<rd;x++){
+      int sx        =  (x+sshift)%rd;
+      int comm_proc = ((x+sshift)/rd)%pd;
+      if ( comm_proc==0 ) {
+	Copy_plane(ret,rhs,dimension,x,sx,cbmask);
+      }
+    }
+  }
+
+  void BeginSimd(Lattice<vobj> &ret,const Lattice<vobj> &rhs,int dimension,int shift,int cbmask)
+  {
+    const int Nsimd = grid->Nsimd();
+    int rd = grid->_rdimensions[dimension];
+    int ld = grid->_ldimensions[dimension];
+    int pd = grid->_processors[dimension];
+    assert(grid->_simd_layout[dimension]==2);
+
+    int permute_type = grid->PermuteType(dimension);
+    int buffer_size  = grid->_slice_nblock[dimension]*grid->_slice_block[dimension];
+    int bytes        = buffer_size*sizeof(scalar_object);
+
+    int cb     = (cbmask==0x2)? Odd : Even;
+    int sshift = grid->CheckerBoardShiftForCB(rhs.Checkerboard(),dimension,shift,cb);
+
+    extract_buffers.emplace_back(rd*Nsimd*buffer_size); cshiftVector<scalar_object> &send_buf = extract_buffers.back();
+    extract_buffers.emplace_back(rd*Nsimd*buffer_size); cshiftVector<scalar_object> &recv_buf = extract_buffers.back();
+
+    ExtractPointerArray<scalar_object>  pointers(Nsimd);
+    ExtractPointerArray<scalar_object> rpointers(Nsimd);
+
+    for(int x=0;x<rd;x++){
+
+      int sx = (x+sshift)%rd;
+      for(int i=0;i<Nsimd;i++){
+	pointers[i] = &send_buf[(x*Nsimd+i)*buffer_size];
+      }
+      Gather_plane_extract(rhs,pointers,dimension,sx,cbmask);
+
+      for(int i=0;i<Nsimd;i++){
+
+	int inner_bit = (Nsimd>>(permute_type+1));
+	int ic= (i&inner_bit)? 1:0;
+
+	int my_coor  = rd*ic + x;
+	int nbr_coor = my_coor+sshift;
+	int nbr_proc = ((nbr_coor)/ld) % pd;// relative shift in processors
+	int nbr_ic   = (nbr_coor%ld)/rd;    // inner coord of peer
+	int nbr_lane = (i&(~inner_bit));
+	if (nbr_ic) nbr_lane|=inner_bit;
+
+	if ( nbr_proc ) {
+	  int xmit_to_rank;
+	  int recv_from_rank;
+	  grid->ShiftedRanks(dimension,nbr_proc,xmit_to_rank,recv_from_rank);
+	  grid->SendToRecvFromBegin(requests,
+				    (void *)pointers[nbr_lane],xmit_to_rank,
+				    (void *)&recv_buf[(x*Nsimd+i)*buffer_size],recv_from_rank,
+				    bytes,NextTag());
+	  rpointers[i] = &recv_buf[(x*Nsimd+i)*buffer_size];
+	} else {
+	  rpointers[i] = pointers[nbr_lane];
+	}
+      }
+      merges.push_back({&ret,dimension,x,cbmask,rpointers});
+    }
+  }
+
+  // Distinct from the rank tags of the blocking SendToRecvFrom
+  int NextTag(void) { tag = (tag+1)%31; return tag+1; }
+};
+
 NAMESPACE_END(Grid); 
 
 #endif
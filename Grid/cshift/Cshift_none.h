@@ -35,6 +35,16 @@ template<class vobj> Lattice<vobj> Cshift(const Lattice<vobj> &rhs,int dimension
   Cshift_local(ret,rhs,dimension,shift);
   return ret;
 }
+// Single rank: no messages to overlap, Begin shifts immediately
+template<class vobj> class CshiftAsync {
+public:
+  void Begin(Lattice<vobj> &ret,const Lattice<vobj> &rhs,int dimension,int shift)
+  {
+    ret.Checkerboard() = rhs.Grid()->CheckerBoardDestination(rhs.Checkerboard(),shift,dimension);
+    Cshift_local(ret,rhs,dimension,shift);
+  }
+  void Complete(void) {};
+};
 NAMESPACE_END(Grid);
 
 #endif
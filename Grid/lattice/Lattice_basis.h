@@ -33,17 +33,107 @@ directory
 
 NAMESPACE_BEGIN(Grid);
 
+//////////////////////////////////////////////////////////////////////////////
+// Block primitives: the inner products of w with basis[j0..j1) in one pass
+// over the block and one global reduction, and the matching multi-axpy
+//   w += sum_j c[j] basis[j]
+// in one pass. Blocks of basisBlock vectors bound the per site scratch.
+//////////////////////////////////////////////////////////////////////////////
+const int basisBlock=16;
+
+template<class Field>
+void rankBasisInnerProducts(std::vector<ComplexD> &ip,const std::vector<Field> &basis,int j0,int j1,const Field &w)
+{
+  typedef typename Field::vector_object vobj;
+  typedef decltype(basis[0].View(AcceleratorRead)) View;
+  typedef decltype(innerProduct(vobj(),vobj())) inner_t;
+
+  GridBase *grid = w.Grid();
+  const uint64_t sites = grid->oSites();
+  assert(ip.size()>=j1);
+
+  deviceVector<inner_t> inner_tmp(basisBlock*sites);
+  auto inner_tmp_v = &inner_tmp[0];
+
+  autoView(w_v,w,AcceleratorRead);
+  for(int b0=j0;b0<j1;b0+=basisBlock){
+    int nb = MIN(basisBlock,j1-b0);
+
+    Vector<View> basis_v; basis_v.reserve(nb);
+    for(int j=0;j<nb;j++){
+      basis_v.push_back(basis[b0+j].View(AcceleratorRead));
+    }
+    View *basis_vp = &basis_v[0];
+
+    accelerator_for(sj,sites*nb,vobj::Nsimd(),{
+      int j  = sj%nb;
+      int ss = sj/nb;
+      auto x = basis_vp[j](ss);
+      auto y = w_v(ss);
+      coalescedWrite(inner_tmp_v[j*sites+ss],innerProduct(x,y));
+    });
+
+    for(int j=0;j<nb;j++){
+      ip[b0+j] = TensorRemove(sumD(&inner_tmp_v[j*sites],sites));
+    }
+    for(int j=0;j<nb;j++) basis_v[j].ViewClose();
+  }
+}
+
+template<class Field>
+void basisInnerProducts(std::vector<ComplexD> &ip,const std::vector<Field> &basis,int j0,int j1,const Field &w)
+{
+  if ( j1<=j0 ) return;
+  rankBasisInnerProducts(ip,basis,j0,j1,w);
+  w.Grid()->GlobalSumVector(&ip[j0],j1-j0);
+}
+
+template<class Field>
+void basisMultiAxpy(Field &w,const std::vector<ComplexD> &c,const std::vector<Field> &basis,int j0,int j1)
+{
+  typedef typename Field::vector_object vobj;
+  typedef typename vobj::scalar_type    scalar_type;
+  typedef decltype(basis[0].View(AcceleratorRead)) View;
+
+  GridBase *grid = w.Grid();
+  const uint64_t sites = grid->oSites();
+
+  autoView(w_v,w,AcceleratorWrite);
+  for(int b0=j0;b0<j1;b0+=basisBlock){
+    int nb = MIN(basisBlock,j1-b0);
+
+    Vector<View> basis_v; basis_v.reserve(nb);
+    Vector<scalar_type> c_v(nb);
+    for(int j=0;j<nb;j++){
+      basis_v.push_back(basis[b0+j].View(AcceleratorRead));
+      c_v[j] = scalar_type(c[b0+j]);
+    }
+    View *basis_vp = &basis_v[0];
+    scalar_type *c_p = &c_v[0];
+
+    accelerator_for(ss,sites,vobj::Nsimd(),{
+      auto B = coalescedRead(w_v[ss]);
+      for(int j=0;j<nb;j++){
+	B = B + c_p[j]*coalescedRead(basis_vp[j][ss]);
+      }
+      coalescedWrite(w_v[ss],B);
+    });
+    for(int j=0;j<nb;j++) basis_v[j].ViewClose();
+  }
+}
+
+// Classical Gram-Schmidt with one reorthogonalisation (CGS2) against the
+// orthonormal basis[0..k): two global reductions in total, however large k,
+// and as stable as modified Gram-Schmidt.
 template<class Field>
 void basisOrthogonalize(std::vector<Field> &basis,Field &w,int k) 
 {
-  // If assume basis[j] are already orthonormal,
-  // can take all inner products in parallel saving 2x bandwidth
-  // Save 3x bandwidth on the second line of loop.
-  // perhaps 2.5x speed up.
-  // 2x overall in Multigrid Lanczos  
-  for(int j=0; j<k; ++j){
-    auto ip = innerProduct(basis[j],w);
-    w = w - ip*basis[j];
+  if ( k<=0 ) return;
+  std::vector<ComplexD> ip(k);
+  for(int pass=0;pass<2;pass++){
+    basisInnerProducts(ip,basis,0,k,w);
+    for(int j=0;j<k;j++) ip[j] = -ip[j];
+    basisMultiAxpy(w,ip,basis,0,k);
   }
 }
 
@@ -232,17 +322,16 @@ void basisSortInPlace(std::vector<Field> & _v,std::vector<RealD>& sort_vals, boo
   basisReorderInPlace(_v,sort_vals,idx);
 }
 
-// PAB: faster to compute the inner products first then fuse loops.
-// If performance critical can improve.
+// Inner products first, in one reduction, then one fused accumulation.
 template<class Field>
 void basisDeflate(const std::vector<Field> &_v,const std::vector<RealD>& eval,const Field& src_orig,Field& result) {
   result = Zero();
   assert(_v.size()==eval.size());
   int N = (int)_v.size();
-  for (int i=0;i<N;i++) {
-    Field& tmp = _v[i];
-    axpy(result,TensorRemove(innerProduct(tmp,src_orig)) / eval[i],tmp,result);
-  }
+  std::vector<ComplexD> ip(N);
+  basisInnerProducts(ip,_v,0,N,src_orig);
+  for (int i=0;i<N;i++) ip[i] = ip[i] / eval[i];
+  basisMultiAxpy(result,ip,_v,0,N);
 }
 
 NAMESPACE_END(Grid);
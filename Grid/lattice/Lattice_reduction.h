@@ -455,7 +455,8 @@ inline auto sum(const LatticeTrinaryExpression<Op,T1,T2,T3> & expr)
 // sliceSum, sliceInnerProduct, sliceAxpy, sliceNorm etc...
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template<class vobj> inline void sliceSum(const Lattice<vobj> &Data,std::vector<typename vobj::scalar_object> &result,int orthogdim)
+// Rank local part of sliceSum; timeslices held by other ranks are left zero
+template<class vobj> inline void rankSliceSum(const Lattice<vobj> &Data,std::vector<typename vobj::scalar_object> &result,int orthogdim)
 {
   ///////////////////////////////////////////////////////
   // FIXME precision promoted summation
@@ -523,6 +524,17 @@ template<class vobj> inline void sliceSum(const Lattice<vobj> &Data,std::vector<
     }
 
   }
+}
+
+template<class vobj> inline void sliceSum(const Lattice<vobj> &Data,std::vector<typename vobj::scalar_object> &result,int orthogdim)
+{
+  typedef typename vobj::scalar_object sobj;
+  typedef typename vobj::scalar_object::scalar_type scalar_type;
+  GridBase  *grid = Data.Grid();
+  int fd=grid->_fdimensions[orthogdim];
+
+  rankSliceSum(Data,result,orthogdim);
+
   scalar_type * ptr = (scalar_type *) &result[0];
   int words = fd*sizeof(sobj)/sizeof(scalar_type);
   grid->GlobalSumVector(ptr, words);
@@ -536,6 +548,144 @@ sliceSum(const Lattice<vobj> &Data,int orthogdim)
   return result;
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Deferred reductions.
+//
+// A ReductionQueue collects the rank local part of several reductions and
+// resolves all of them with a single GlobalSumVector, so back to back
+// innerProduct / norm2 / sum / sliceSum calls pay one network latency
+// instead of one each:
+//
+//   ReductionQueue q(grid);
+//   auto ts = q.innerProduct(t,s);
+//   auto tt = q.norm2(t);
+//   omega = real(ts.get()) / tt.get();   // one global sum for both
+//
+// Begin() posts the reduction non-blocking so that independent work can
+// overlap it; otherwise the first handle read performs a blocking sum.
+// Resolution is collective: every rank must queue the same reductions and
+// read a handle (or call Complete) at the same point. Reductions cannot be
+// queued once Begin has been called; Reset empties the queue for reuse.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class ReductionQueue;
+
+// Packs a scalar, complex or tensor type into real double words
+template<class T> struct ReductionWords {
+  typedef typename GridTypeMapper<typename GridTypeMapper<T>::scalar_type>::Realified real_type;
+  static constexpr int words = sizeof(T)/sizeof(real_type);
+  static void pack(const T *in,int n,RealD *out) {
+    const real_type *r = (const real_type *)in;
+    for(int w=0;w<n*words;w++) out[w] = r[w];
+  }
+  static void unpack(const RealD *in,int n,T *out) {
+    real_type *r = (real_type *)out;
+    for(int w=0;w<n*words;w++) r[w] = in[w];
+  }
+};
+
+template<class T> class ReductionHandle {
+  ReductionQueue *queue;
+  size_t offset;
+  int    count;
+public:
+  ReductionHandle() : queue(nullptr), offset(0), count(0) {};
+  ReductionHandle(ReductionQueue *_queue,size_t _offset,int _count) : queue(_queue), offset(_offset), count(_count) {};
+
+  int size(void) const { return count; }
+  inline T get(int i=0) const;
+  inline void get(std::vector<T> &result) const;
+  operator T() const { return get(); }
+};
+
+class ReductionQueue {
+  GridBase           *grid;
+  std::vector<RealD>  words;
+  CommsRequest_t      request;
+  bool                started;
+  bool                reduced;
+public:
+  ReductionQueue(GridBase *_grid) : grid(_grid), started(false), reduced(false) {};
+  ~ReductionQueue() { if ( started ) Complete(); }
+
+  ReductionQueue(const ReductionQueue &) = delete;
+  ReductionQueue &operator=(const ReductionQueue &) = delete;
+
+  template<class T> ReductionHandle<T> push(const T *local,int n) {
+    assert(!started && !reduced);
+    size_t offset = words.size();
+    words.resize(offset + n*ReductionWords<T>::words);
+    ReductionWords<T>::pack(local,n,&words[offset]);
+    return ReductionHandle<T>(this,offset,n);
+  }
+
+  template<class vobj> ReductionHandle<ComplexD> innerProduct(const Lattice<vobj> &left,const Lattice<vobj> &right) {
+    conformable(left.Grid(),grid);
+    conformable(right.Grid(),grid);
+    ComplexD nrm = rankInnerProduct(left,right);
+    return push(&nrm,1);
+  }
+  template<class vobj> ReductionHandle<RealD> norm2(const Lattice<vobj> &arg) {
+    conformable(arg.Grid(),grid);
+    RealD nrm = real(rankInnerProduct(arg,arg));
+    return push(&nrm,1);
+  }
+  template<class vobj> ReductionHandle<typename vobj::scalar_objectD> sum(const Lattice<vobj> &arg) {
+    conformable(arg.Grid(),grid);
+    autoView( arg_v, arg, AcceleratorRead);
+    typename vobj::scalar_objectD ssum = sumD(&arg_v[0],grid->oSites());
+    return push(&ssum,1);
+  }
+  template<class vobj> ReductionHandle<typename vobj::scalar_object> sliceSum(const Lattice<vobj> &Data,int orthogdim) {
+    conformable(Data.Grid(),grid);
+    std::vector<typename vobj::scalar_object> lsum;
+    rankSliceSum(Data,lsum,orthogdim);
+    return push(&lsum[0],lsum.size());
+  }
+
+  // Post the global sum of everything queued so far
+  void Begin(void) {
+    assert(!started && !reduced);
+    started = true;
+    if ( words.size() ) grid->GlobalSumVectorBegin(&words[0],words.size(),request);
+  }
+  void Complete(void) {
+    if ( reduced ) return;
+    if ( started ) {
+      if ( words.size() ) grid->GlobalSumVectorComplete(request);
+      started = false;
+    } else if ( words.size() ) {
+      grid->GlobalSumVector(&words[0],words.size());
+    }
+    reduced = true;
+  }
+  void Reset(void) {
+    if ( started ) Complete();
+    words.resize(0);
+    reduced = false;
+  }
+  bool Reduced(void) const { return reduced; }
+
+  const RealD *Result(size_t offset) {
+    Complete();
+    return &words[offset];
+  }
+};
+
+template<class T> inline T ReductionHandle<T>::get(int i) const
+{
+  assert(queue != nullptr);
+  assert(i < count);
+  T result;
+  ReductionWords<T>::unpack(queue->Result(offset + i*ReductionWords<T>::words),1,&result);
+  return result;
+}
+template<class T> inline void ReductionHandle<T>::get(std::vector<T> &result) const
+{
+  assert(queue != nullptr);
+  result.resize(count);
+  ReductionWords<T>::unpack(queue->Result(offset),count,&result[0]);
+}
+
 
 template<class vobj>
 static void sliceInnerProductVector( std::vector<ComplexD> & result, const Lattice<vobj> &lhs,const Lattice<vobj> &rhs,int orthogdim) 
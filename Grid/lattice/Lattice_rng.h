@@ -408,6 +408,50 @@ public:
     _time_counter += usecond()- inner_time_counter;
   }
 
+  ////////////////////////////////////////////////////////////////////////////
+  // Draw nword numbers per site exactly as nword successive fill() calls on
+  // one word lattices would: the same generator per site, the distribution
+  // reset before each draw, and the fine sites of a generator drawn in turn.
+  // The draws for each fine site are handed to a host kernel in one pass,
+  //   kernel(sm, draws)   with the word w lane si number at draws[w*Nsimd+si]
+  // so that callers can build site objects without a lattice per word.
+  ////////////////////////////////////////////////////////////////////////////
+  template <class distribution,class Kernel> inline void fillSequence(GridBase *fine,int nword,std::vector<distribution> &dist,Kernel kernel)
+  {
+    assert(!fine->_isCheckerBoarded);
+
+    double inner_time_counter = usecond();
+
+    int multiplicity = RNGfillable_general(_grid, fine);
+    int Nsimd  = _grid->Nsimd();
+    int osites = _grid->oSites();
+
+    // One draw buffer per thread, reused across its sites
+    int ndraw = multiplicity*nword*Nsimd;
+    int max_threads = thread_max();
+    std::vector<RealD> draws_thr(ndraw * max_threads);
+    thread_region
+      {
+	RealD *draws = &draws_thr[ndraw * thread_num()];
+	thread_for_in_region( ss, osites, {
+	  for (int w = 0; w < nword; w++) {
+	    for (int m = 0; m < multiplicity; m++) {
+	      for (int si = 0; si < Nsimd; si++) {
+		int gdx = generator_idx(ss, si);
+		dist[gdx].reset();
+		fillScalar(draws[(m*nword+w)*Nsimd+si], dist[gdx], _generators[gdx]);
+	      }
+	    }
+	  }
+	  for (int m = 0; m < multiplicity; m++) {
+	    kernel(multiplicity * ss + m, &draws[m*nword*Nsimd]);
+	  }
+	});
+      }
+
+    _time_counter += usecond()- inner_time_counter;
+  }
+
     void SeedUniqueString(const std::string &s){
       std::vector<int> seeds;
       seeds = GridChecksum::sha256_seeds(s);
@@ -278,7 +278,8 @@ public:
 	  global[d] = plocal[d]*processors[d];
 	}
 
-	old_grid = new GridCartesian(global,simd,processors);
+	// on the unpadded grid's communicator, which may be a split one
+	old_grid = new GridCartesian(global,simd,processors,*unpadded_grid);
       }
       grids.push_back(old_grid);
     }
@@ -2,3 +2,4 @@
 
 int                    Grid::BinaryIO::latticeWriteMaxRetry = -1;
 Grid::BinaryIO::IoPerf Grid::BinaryIO::lastPerf;
+uint64_t               Grid::BinaryIO::latticeIoBufferBytes = 0;
@@ -39,6 +39,8 @@
 #endif
 
 #include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <algorithm>
 
 NAMESPACE_BEGIN(Grid);
@@ -83,10 +85,14 @@ class BinaryIO {
   {
     uint64_t size{0},time{0};
     double   mbytesPerSecond{0.};
+    // Streamed path only: (un)vectorise+munge and checksum+byte order stages
+    uint64_t vectorTime{0},checksumTime{0};
+    double   vectorMBytesPerSecond{0.},checksumMBytesPerSecond{0.};
   };
 
   static IoPerf lastPerf;
   static int latticeWriteMaxRetry;
+  static uint64_t latticeIoBufferBytes; // >0: stream lattice objects through a buffer this size
 
   /////////////////////////////////////////////////////////////////////////////
   // more byte manipulation helpers
@@ -108,19 +114,25 @@ class BinaryIO {
   template <class fobj>
   static inline void NerscChecksum(GridBase *grid, std::vector<fobj> &fbuf, uint32_t &nersc_csum)
   {
-    const uint64_t size32 = sizeof(fobj) / sizeof(uint32_t);
-
     uint64_t lsites = grid->lSites();
     if (fbuf.size() == 1)
     {
       lsites = 1;
     }
+    NerscChecksumSlab(&fbuf[0], lsites, nersc_csum);
+  }
+
+  // Accumulates into nersc_csum over nsite objects
+  template <class fobj>
+  static inline void NerscChecksumSlab(fobj *fbuf, uint64_t nsite, uint32_t &nersc_csum)
+  {
+    const uint64_t size32 = sizeof(fobj) / sizeof(uint32_t);
 
     thread_region
     {
       uint32_t nersc_csum_thr = 0;
 
-      thread_for_in_region( local_site, lsites, 
+      thread_for_in_region( local_site, nsite, 
       {
         uint32_t *site_buf = (uint32_t *)&fbuf[local_site];
         for (uint64_t j = 0; j < size32; j++)
@@ -138,12 +150,19 @@ class BinaryIO {
 
   template<class fobj> static inline void ScidacChecksum(GridBase *grid,std::vector<fobj> &fbuf,uint32_t &scidac_csuma,uint32_t &scidac_csumb)
   {
-    int nd = grid->_ndimension;
-
     uint64_t lsites              =grid->lSites();
     if (fbuf.size()==1) {
       lsites=1;
     }
+    ScidacChecksumSlab(grid,&fbuf[0],0,lsites,scidac_csuma,scidac_csumb);
+  }
+
+  // Accumulates over nsite objects holding local lexicographic sites site0, site0+1, ...
+  template<class fobj> static inline void ScidacChecksumSlab(GridBase *grid,fobj *fbuf,uint64_t site0,uint64_t nsite,
+							     uint32_t &scidac_csuma,uint32_t &scidac_csumb)
+  {
+    int nd = grid->_ndimension;
+
     Coordinate local_vol   =grid->LocalDimensions();
     Coordinate local_start =grid->LocalStarts();
     Coordinate global_vol  =grid->FullDimensions();
@@ -155,10 +174,10 @@ class BinaryIO {
       uint32_t scidac_csumb_thr=0;
       uint32_t site_crc=0;
 
-      thread_for_in_region( local_site, lsites, 
+      thread_for_in_region( slab_site, nsite, 
       {
 
-	uint32_t * site_buf = (uint32_t *)&fbuf[local_site];
+	uint32_t * site_buf = (uint32_t *)&fbuf[slab_site];
 
 	/* 
 	 * Scidac csum  is rather more heavyweight
@@ -166,6 +185,7 @@ class BinaryIO {
 	 */
 	
 	int64_t global_site;
+	uint64_t local_site = site0 + slab_site;
 
 	Lexicographic::CoorFromIndex(coor,local_site,local_vol);
 
@@ -534,6 +554,355 @@ class BinaryIO {
     }
   }
 
+  /////////////////////////////////////////////////////////////////////////////
+  // Split form of IOobject write for deferred I/O.
+  //
+  // IOobjectEncode is collective: checksums and byte order as IOobject.
+  // IOobjectWriteLocal makes no communication calls, so it may run on a
+  // helper thread while the main thread carries on; each rank pwrites its
+  // own x-runs at their lexicographic place in the file, and a buffer of
+  // size 1 is written by rank 0 only. The file must already exist.
+  //////////////////////////////////////////////////////////////////////////////////////
+  template<class fobj>
+  static inline void IOobjectEncode(GridBase *grid,
+				    std::vector<fobj> &iodata,
+				    const std::string &format,
+				    uint32_t &nersc_csum,
+				    uint32_t &scidac_csuma,
+				    uint32_t &scidac_csumb)
+  {
+    nersc_csum=0;
+    scidac_csuma=0;
+    scidac_csumb=0;
+
+    int ieee32big = (format == std::string("IEEE32BIG"));
+    int ieee32    = (format == std::string("IEEE32"));
+    int ieee64big = (format == std::string("IEEE64BIG"));
+    int ieee64    = (format == std::string("IEEE64") || format == std::string("IEEE64LITTLE"));
+    assert((ieee64+ieee32+ieee64big+ieee32big)==1);
+
+    NerscChecksum(grid,iodata,nersc_csum);
+    if (ieee32big) htobe32_v((void *)&iodata[0], sizeof(fobj)*iodata.size());
+    if (ieee32)    htole32_v((void *)&iodata[0], sizeof(fobj)*iodata.size());
+    if (ieee64big) htobe64_v((void *)&iodata[0], sizeof(fobj)*iodata.size());
+    if (ieee64)    htole64_v((void *)&iodata[0], sizeof(fobj)*iodata.size());
+    ScidacChecksum(grid,iodata,scidac_csuma,scidac_csumb);
+
+    if (iodata.size() != 1){
+      grid->GlobalSum(nersc_csum);
+      grid->GlobalXOR(scidac_csuma);
+      grid->GlobalXOR(scidac_csumb);
+    }
+  }
+
+  template<class fobj>
+  static inline bool IOobjectWriteLocal(GridBase *grid,
+					std::vector<fobj> &iodata,
+					const std::string &file,
+					uint64_t offset)
+  {
+    int ndim = grid->Dimensions();
+    Coordinate gLattice = grid->GlobalDimensions();
+    Coordinate lLattice = grid->LocalDimensions();
+    Coordinate lStart   = grid->LocalStarts();
+
+    if ( (iodata.size()==1) && (grid->ThisRank()!=0) ) return true;
+
+    int fd = ::open(file.c_str(),O_WRONLY);
+    if ( fd < 0 ) {
+      std::cout << GridLogError << "IOobjectWriteLocal: cannot open " << file << std::endl;
+      return false;
+    }
+
+    bool ok = true;
+    uint64_t run   = (iodata.size()==1) ? 1 : lLattice[0];
+    uint64_t nruns = iodata.size()/run;
+    Coordinate coor(ndim);
+    for(uint64_t r=0;r<nruns && ok;r++){
+      int64_t gidx;
+      Lexicographic::CoorFromIndex(coor,r*run,lLattice);
+      for(int d=0;d<ndim;d++) coor[d] += lStart[d];
+      Lexicographic::IndexFromCoor(coor,gidx,gLattice);
+      if ( iodata.size()==1 ) gidx = 0;
+
+      const char *buf = (const char *)&iodata[r*run];
+      size_t bytes = run*sizeof(fobj);
+      off_t  pos   = offset + gidx*sizeof(fobj);
+      while ( bytes ) {
+	ssize_t n = ::pwrite(fd,buf,bytes,pos);
+	if ( n <= 0 ) { ok = false; break; }
+	buf += n; pos += n; bytes -= n;
+      }
+    }
+    if ( ::close(fd) ) ok = false;
+    if ( !ok ) std::cout << GridLogError << "IOobjectWriteLocal: write failed on " << file << std::endl;
+    return ok;
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Streamed lattice object I/O in bounded memory.
+  //
+  // Taken by read/writeLatticeObject when latticeIoBufferBytes > 0 and the
+  // control is plain BINARYIO_LEXICOGRAPHIC on a full grid. Each rank moves
+  // its local volume through one buffer of at most latticeIoBufferBytes,
+  // rounded to whole x-runs, and (un)vectorises, munges, byte swaps and
+  // checksums it a slab at a time, reading or writing each x-run with
+  // pread/pwrite at its lexicographic place in the file. The file contents
+  // and checksums are the same as those of IOobject.
+  //////////////////////////////////////////////////////////////////////////////////////
+  static inline bool IOobjectStreamable(GridBase *grid,int control)
+  {
+    return (latticeIoBufferBytes > 0) && (control == BINARYIO_LEXICOGRAPHIC) && (!grid->_isCheckerBoarded);
+  }
+
+  static inline uint64_t IOobjectSlabSites(GridBase *grid,uint64_t objbytes)
+  {
+    uint64_t lsites = grid->lSites();
+    uint64_t run    = grid->LocalDimensions()[0];
+    uint64_t slab   = (latticeIoBufferBytes/objbytes/run)*run;
+    return std::min(lsites,std::max(slab,run));
+  }
+
+  static inline void IOobjectAbort(const std::string &msg,const std::string &file)
+  {
+    std::cout << GridLogError << msg << " " << file << std::endl;
+#ifdef USE_MPI_IO
+    MPI_Abort(MPI_COMM_WORLD,1);
+#else
+    exit(1);
+#endif
+  }
+
+  // pread or pwrite the x-runs of local lexicographic sites [site0,site0+nsite)
+  template<class fobj>
+  static inline bool IOobjectSlabRuns(GridBase *grid,int fd,fobj *buf,uint64_t site0,uint64_t nsite,
+				      uint64_t offset,int control)
+  {
+    int ndim = grid->Dimensions();
+    Coordinate gLattice = grid->GlobalDimensions();
+    Coordinate lLattice = grid->LocalDimensions();
+    Coordinate lStart   = grid->LocalStarts();
+    uint64_t run = lLattice[0];
+    Coordinate coor(ndim);
+
+    for(uint64_t r=0;r<nsite;r+=run){
+      int64_t gidx;
+      Lexicographic::CoorFromIndex(coor,site0+r,lLattice);
+      for(int d=0;d<ndim;d++) coor[d] += lStart[d];
+      Lexicographic::IndexFromCoor(coor,gidx,gLattice);
+
+      char  *ptr   = (char *)&buf[r];
+      size_t bytes = run*sizeof(fobj);
+      off_t  pos   = offset + gidx*sizeof(fobj);
+      while ( bytes ) {
+	ssize_t n = (control & BINARYIO_READ) ? ::pread (fd,ptr,bytes,pos)
+	                                      : ::pwrite(fd,ptr,bytes,pos);
+	if ( n <= 0 ) return false;
+	ptr += n; pos += n; bytes -= n;
+      }
+    }
+    return true;
+  }
+
+  static inline void IOobjectStreamedPerf(GridBase *grid,uint64_t bytes,int control,
+					  GridStopWatch &iotimer,GridStopWatch &vtimer,GridStopWatch &bstimer)
+  {
+    auto mbps = [](uint64_t b,uint64_t us) { return us ? b/1024./1024./(us/1.0e6) : 0.; };
+    lastPerf.size                    = bytes*grid->ProcessorCount();
+    lastPerf.time                    = iotimer.useconds();
+    lastPerf.mbytesPerSecond         = mbps(lastPerf.size,lastPerf.time);
+    lastPerf.vectorTime              = vtimer.useconds();
+    lastPerf.vectorMBytesPerSecond   = mbps(lastPerf.size,lastPerf.vectorTime);
+    lastPerf.checksumTime            = bstimer.useconds();
+    lastPerf.checksumMBytesPerSecond = mbps(lastPerf.size,lastPerf.checksumTime);
+
+    std::cout<<GridLogMessage<<"IOobjectStreamed: ";
+    if ( control & BINARYIO_READ) std::cout << " read  ";
+    else                          std::cout << " write ";
+    std::cout<< lastPerf.size <<" bytes in "<< iotimer.Elapsed() <<" "
+	     << lastPerf.mbytesPerSecond <<" MB/s "<<std::endl;
+    std::cout<<GridLogMessage<<"IOobjectStreamed: vectorize overhead "<<vtimer.Elapsed()
+	     <<" "<<lastPerf.vectorMBytesPerSecond<<" MB/s"<<std::endl;
+    std::cout<<GridLogMessage<<"IOobjectStreamed: endian and checksum overhead "<<bstimer.Elapsed()
+	     <<" "<<lastPerf.checksumMBytesPerSecond<<" MB/s"<<std::endl;
+  }
+
+  // Hands each host order slab to unpack(iodata,site0,nsite); a no-op
+  // unpack leaves just the checksums of the file (write verification)
+  template<class fobj,class unpacker>
+  static inline void IOobjectReadStreamed(GridBase *grid,
+					  const std::string &file,
+					  uint64_t offset,
+					  const std::string &format,
+					  uint32_t &nersc_csum,
+					  uint32_t &scidac_csuma,
+					  uint32_t &scidac_csumb,
+					  unpacker unpack)
+  {
+    uint64_t lsites = grid->lSites();
+    uint64_t slab   = IOobjectSlabSites(grid,sizeof(fobj));
+    std::vector<fobj> iodata(slab);
+    GridStopWatch iotimer, vtimer, bstimer;
+
+    int ieee32big = (format == std::string("IEEE32BIG"));
+    int ieee32    = (format == std::string("IEEE32"));
+    int ieee64big = (format == std::string("IEEE64BIG"));
+    int ieee64    = (format == std::string("IEEE64") || format == std::string("IEEE64LITTLE"));
+    assert((ieee64+ieee32+ieee64big+ieee32big)==1);
+
+    nersc_csum=0;
+    scidac_csuma=0;
+    scidac_csumb=0;
+
+    std::cout << GridLogMessage <<"IOobjectStreamed: read " << file << " in slabs of "
+	      << slab*sizeof(fobj) << " bytes" << std::endl;
+    grid->Barrier();
+    int fd = ::open(file.c_str(),O_RDONLY);
+    if ( fd < 0 ) IOobjectAbort("IOobjectStreamed: cannot open",file);
+
+    for(uint64_t site0=0;site0<lsites;site0+=slab){
+      uint64_t nsite = std::min(slab,lsites-site0);
+      uint64_t bytes = nsite*sizeof(fobj);
+
+      iotimer.Start();
+      bool ok = IOobjectSlabRuns(grid,fd,&iodata[0],site0,nsite,offset,BINARYIO_READ);
+      iotimer.Stop();
+      if ( !ok ) IOobjectAbort("IOobjectStreamed: read failed on",file);
+
+      bstimer.Start();
+      ScidacChecksumSlab(grid,&iodata[0],site0,nsite,scidac_csuma,scidac_csumb);
+      if (ieee32big) be32toh_v((void *)&iodata[0], bytes);
+      if (ieee32)    le32toh_v((void *)&iodata[0], bytes);
+      if (ieee64big) be64toh_v((void *)&iodata[0], bytes);
+      if (ieee64)    le64toh_v((void *)&iodata[0], bytes);
+      NerscChecksumSlab(&iodata[0],nsite,nersc_csum);
+      bstimer.Stop();
+
+      vtimer.Start();
+      unpack(&iodata[0],site0,nsite);
+      vtimer.Stop();
+    }
+    ::close(fd);
+
+    IOobjectStreamedPerf(grid,lsites*sizeof(fobj),BINARYIO_READ,iotimer,vtimer,bstimer);
+
+    grid->Barrier();
+    grid->GlobalSum(nersc_csum);
+    grid->GlobalXOR(scidac_csuma);
+    grid->GlobalXOR(scidac_csumb);
+    grid->Barrier();
+  }
+
+  template<class vobj,class fobj,class munger>
+  static inline void readLatticeObjectStreamed(Lattice<vobj> &Umu,
+					       const std::string &file,
+					       munger munge,
+					       uint64_t offset,
+					       const std::string &format,
+					       uint32_t &nersc_csum,
+					       uint32_t &scidac_csuma,
+					       uint32_t &scidac_csumb)
+  {
+    typedef typename vobj::scalar_object sobj;
+    GridBase *grid = Umu.Grid();
+    int ndim = grid->Dimensions();
+    Coordinate lLattice = grid->LocalDimensions();
+
+    autoView( U_v, Umu, CpuWrite);
+    auto unpack = [&](fobj *iodata,uint64_t site0,uint64_t nsite) {
+      thread_for(s,nsite,{
+	Coordinate lcoor(ndim);
+	sobj tmp;
+	Lexicographic::CoorFromIndex(lcoor,site0+s,lLattice);
+	munge(iodata[s],tmp);
+	insertLane(grid->iIndex(lcoor),U_v[grid->oIndex(lcoor)],tmp);
+      });
+    };
+    IOobjectReadStreamed<fobj>(grid,file,offset,format,nersc_csum,scidac_csuma,scidac_csumb,unpack);
+  }
+
+  template<class vobj,class fobj,class munger>
+  static inline void writeLatticeObjectStreamed(Lattice<vobj> &Umu,
+						const std::string &file,
+						munger munge,
+						uint64_t offset,
+						const std::string &format,
+						uint32_t &nersc_csum,
+						uint32_t &scidac_csuma,
+						uint32_t &scidac_csumb)
+  {
+    typedef typename vobj::scalar_object sobj;
+    GridBase *grid = Umu.Grid();
+    int ndim = grid->Dimensions();
+    Coordinate lLattice = grid->LocalDimensions();
+    uint64_t lsites = grid->lSites();
+    uint64_t slab   = IOobjectSlabSites(grid,sizeof(fobj));
+    std::vector<fobj> iodata(slab);
+    GridStopWatch iotimer, vtimer, bstimer;
+
+    int ieee32big = (format == std::string("IEEE32BIG"));
+    int ieee32    = (format == std::string("IEEE32"));
+    int ieee64big = (format == std::string("IEEE64BIG"));
+    int ieee64    = (format == std::string("IEEE64") || format == std::string("IEEE64LITTLE"));
+    assert((ieee64+ieee32+ieee64big+ieee32big)==1);
+
+    nersc_csum=0;
+    scidac_csuma=0;
+    scidac_csumb=0;
+
+    std::cout << GridLogMessage <<"IOobjectStreamed: write " << file << " in slabs of "
+	      << slab*sizeof(fobj) << " bytes" << std::endl;
+
+    // Create without truncating: a header may already precede offset
+    grid->Barrier();
+    if ( grid->IsBoss() ) {
+      int fd = ::open(file.c_str(),O_WRONLY|O_CREAT,0644);
+      if ( fd < 0 ) IOobjectAbort("IOobjectStreamed: cannot create",file);
+      ::close(fd);
+    }
+    grid->Barrier();
+    int fd = ::open(file.c_str(),O_WRONLY);
+    if ( fd < 0 ) IOobjectAbort("IOobjectStreamed: cannot open",file);
+
+    autoView( U_v, Umu, CpuRead);
+    for(uint64_t site0=0;site0<lsites;site0+=slab){
+      uint64_t nsite = std::min(slab,lsites-site0);
+      uint64_t bytes = nsite*sizeof(fobj);
+
+      vtimer.Start();
+      thread_for(s,nsite,{
+	Coordinate lcoor(ndim);
+	Lexicographic::CoorFromIndex(lcoor,site0+s,lLattice);
+	sobj tmp = extractLane(grid->iIndex(lcoor),U_v[grid->oIndex(lcoor)]);
+	munge(tmp,iodata[s]);
+      });
+      vtimer.Stop();
+
+      bstimer.Start();
+      NerscChecksumSlab(&iodata[0],nsite,nersc_csum);
+      if (ieee32big) htobe32_v((void *)&iodata[0], bytes);
+      if (ieee32)    htole32_v((void *)&iodata[0], bytes);
+      if (ieee64big) htobe64_v((void *)&iodata[0], bytes);
+      if (ieee64)    htole64_v((void *)&iodata[0], bytes);
+      ScidacChecksumSlab(grid,&iodata[0],site0,nsite,scidac_csuma,scidac_csumb);
+      bstimer.Stop();
+
+      iotimer.Start();
+      bool ok = IOobjectSlabRuns(grid,fd,&iodata[0],site0,nsite,offset,BINARYIO_WRITE);
+      iotimer.Stop();
+      if ( !ok ) IOobjectAbort("IOobjectStreamed: write failed on",file);
+    }
+    if ( ::close(fd) ) IOobjectAbort("IOobjectStreamed: write failed on",file);
+
+    IOobjectStreamedPerf(grid,lsites*sizeof(fobj),BINARYIO_WRITE,iotimer,vtimer,bstimer);
+
+    grid->Barrier();
+    grid->GlobalSum(nersc_csum);
+    grid->GlobalXOR(scidac_csuma);
+    grid->GlobalXOR(scidac_csumb);
+    grid->Barrier();
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // Read a Lattice of object
   //////////////////////////////////////////////////////////////////////////////////////
@@ -555,6 +924,11 @@ class BinaryIO {
     GridBase *grid = Umu.Grid();
     uint64_t lsites = grid->lSites();
 
+    if ( IOobjectStreamable(grid,control) ) {
+      readLatticeObjectStreamed<vobj,fobj>(Umu,file,munge,offset,format,nersc_csum,scidac_csuma,scidac_csumb);
+      return;
+    }
+
     std::vector<sobj> scalardata(lsites); 
     std::vector<fobj>     iodata(lsites); // Munge, checksum, byte order in here
     
@@ -594,6 +968,29 @@ class BinaryIO {
     int attemptsLeft = std::max(0, BinaryIO::latticeWriteMaxRetry);
     bool checkWrite = (BinaryIO::latticeWriteMaxRetry >= 0);
 
+    if ( IOobjectStreamable(grid,control) ) {
+      // Read back checksums only, so memory stays bounded by the buffer
+      while (attemptsLeft >= 0)
+      {
+        writeLatticeObjectStreamed<vobj,fobj>(Umu,file,munge,offsetCopy,format,
+					      nersc_csum,scidac_csuma,scidac_csumb);
+        if (!checkWrite) break;
+
+        uint32_t cknersc_csum, ckscidac_csuma, ckscidac_csumb;
+        std::cout << GridLogMessage << "writeLatticeObject: read back object" << std::endl;
+        IOobjectReadStreamed<fobj>(grid,file,offsetCopy,format,cknersc_csum,ckscidac_csuma,ckscidac_csumb,
+				   [](fobj *,uint64_t,uint64_t) {});
+        if ((cknersc_csum == nersc_csum) and (ckscidac_csuma == scidac_csuma) and (ckscidac_csumb == scidac_csumb))
+        {
+          std::cout << GridLogMessage << "writeLatticeObject: read test checksum correct" << std::endl;
+          break;
+        }
+        std::cout << GridLogMessage << "writeLatticeObject: read test checksum failure, re-writing (" << attemptsLeft << " attempt(s) remaining)" << std::endl;
+        attemptsLeft--;
+      }
+      return;
+    }
+
     std::vector<sobj> scalardata(lsites); 
     std::vector<fobj>     iodata(lsites); // Munge, checksum, byte order in here
 
@@ -58,15 +58,21 @@ public:
   RealD deriv_max_sum;
   RealD Fdt_norm_sum;
   RealD Fdt_max_sum;
-  int   deriv_num;
+  int   deriv_num;     // diagnostic samples behind the force averages
+  int   deriv_calls;   // force evaluations
   RealD deriv_us;
   RealD S_us;
   RealD refresh_us;
+  uint64_t deriv_iter;    // solver iterations inside deriv, S and refresh
+  uint64_t S_iter;
+  uint64_t refresh_iter;
   void  reset_timer(void)        {
     deriv_us = S_us = refresh_us = 0.0;
+    deriv_iter = S_iter = refresh_iter = 0;
     deriv_norm_sum = deriv_max_sum=0.0;
     Fdt_max_sum =  Fdt_norm_sum = 0.0;
     deriv_num=0;
+    deriv_calls=0;
   }
   void  deriv_log(RealD nrm, RealD max,RealD Fdt_nrm,RealD Fdt_max) {
     if ( max > deriv_max_sum ) {
@@ -85,12 +91,13 @@ public:
   RealD deriv_timer(void)        { return deriv_us; };
   RealD S_timer(void)            { return S_us; };
   RealD refresh_timer(void)      { return refresh_us; };
-  void deriv_timer_start(void)   { deriv_us-=usecond(); }
-  void deriv_timer_stop(void)    { deriv_us+=usecond(); }
-  void refresh_timer_start(void) { refresh_us-=usecond(); }
-  void refresh_timer_stop(void)  { refresh_us+=usecond(); }
-  void S_timer_start(void)       { S_us-=usecond(); }
-  void S_timer_stop(void)        { S_us+=usecond(); }
+  static uint64_t solver_iterations(void) { uint64_t solves, iters; SolverGetCounts(solves,iters); return iters; }
+  void deriv_timer_start(void)   { deriv_us-=usecond();   deriv_iter-=solver_iterations(); deriv_calls++; }
+  void deriv_timer_stop(void)    { deriv_us+=usecond();   deriv_iter+=solver_iterations(); }
+  void refresh_timer_start(void) { refresh_us-=usecond(); refresh_iter-=solver_iterations(); }
+  void refresh_timer_stop(void)  { refresh_us+=usecond(); refresh_iter+=solver_iterations(); }
+  void S_timer_start(void)       { S_us-=usecond();       S_iter-=solver_iterations(); }
+  void S_timer_stop(void)        { S_us+=usecond();       S_iter+=solver_iterations(); }
   /////////////////////////////
   // Heatbath?
   /////////////////////////////
@@ -38,6 +38,8 @@ NAMESPACE_CHECK(ActionBase);
 NAMESPACE_CHECK(ActionSet);
 #include <Grid/qcd/action/ActionParams.h>
 NAMESPACE_CHECK(ActionParams);
+#include <Grid/qcd/action/ConcurrentAction.h>
+NAMESPACE_CHECK(ConcurrentAction);
 
 #include <Grid/qcd/action/filters/MomentumFilter.h>
 #include <Grid/qcd/action/filters/DirichletFilter.h>
@@ -0,0 +1,252 @@
+/*************************************************************************************
+
+Grid physics library, www.github.com/paboyle/Grid
+
+Source file: ./lib/qcd/action/ConcurrentAction.h
+
+Copyright (C) 2015
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+See the full license in the file "LICENSE" in the top level distribution
+directory
+*************************************************************************************/
+/*  END LEGAL */
+#ifndef CONCURRENT_ACTION_H
+#define CONCURRENT_ACTION_H
+
+NAMESPACE_BEGIN(Grid);
+
+////////////////////////////////////////////////////////////////////////
+// Independent actions evaluated concurrently on split communicators.
+//
+// The full grid's ranks are split into subgroups with the GridCartesian
+// split constructor; each subgroup holds the whole lattice. Every rank
+// passes the actions of its own subgroup, built on the split grid, and
+// the ConcurrentAction goes into an ActionLevel in place of the separate
+// actions. The gauge field is scattered to all subgroups with Grid_split,
+// each subgroup evaluates only its actions, and the forces are gathered
+// back with Grid_unsplit and summed; action values are summed over
+// subgroups. The integrator sees one action whose force is the total.
+//
+// Pseudofermions are drawn from split-grid generators reseeded from the
+// serial RNG on every refresh, so every rank consumes the serial RNG
+// identically and a restart from a checkpoint reproduces them. Each site
+// generator is seeded from the subgroup and its global site index, so the
+// subgroups draw independent noise and the draw does not depend on the
+// rank layout of the split grid.
+////////////////////////////////////////////////////////////////////////
+template <class GaugeField>
+class ConcurrentAction : public Action<GaugeField>
+{
+public:
+  typedef Action<GaugeField>* ActPtr;
+
+private:
+  GridBase *FullGrid;
+  GridBase *SplitGrid;
+  int split_rank;
+  int nsplit;
+  std::vector<ActPtr> actions;  // this rank's subgroup only
+
+  GridSerialRNG   sRNG_split;
+  GridParallelRNG pRNG_split;
+
+  void split(const GaugeField &U, GaugeField &U_split)
+  {
+    std::vector<GaugeField> U_full(nsplit, FullGrid);
+    for (int s = 0; s < nsplit; s++) U_full[s] = U;
+    Grid_split(U_full, U_split);
+  }
+
+  // Every rank of a subgroup contributes the subgroup's value
+  RealD sum_subgroups(RealD mine)
+  {
+    std::vector<RealD> all(nsplit, 0.0);
+    all[split_rank] = mine / SplitGrid->_Nprocessors;
+    FullGrid->GlobalSumVector(&all[0], nsplit);
+    RealD total = 0.0;
+    for (int s = 0; s < nsplit; s++) total += all[s];
+    return total;
+  }
+
+public:
+  ConcurrentAction(GridBase *_FullGrid, GridBase *_SplitGrid, int _split_rank,
+                   const std::vector<ActPtr> &_actions)
+    : FullGrid(_FullGrid), SplitGrid(_SplitGrid), split_rank(_split_rank),
+      actions(_actions), pRNG_split(_SplitGrid)
+  {
+    nsplit = FullGrid->_Nprocessors / SplitGrid->_Nprocessors;
+    assert(nsplit * SplitGrid->_Nprocessors == FullGrid->_Nprocessors);
+    assert(split_rank >= 0 && split_rank < nsplit);
+  }
+
+  const std::vector<ActPtr> &subgroup_actions(void) { return actions; }
+
+  virtual std::string action_name()
+  {
+    std::stringstream sstream;
+    sstream << "ConcurrentAction[" << nsplit << "]";
+    return sstream.str();
+  }
+
+  virtual std::string LogParameters()
+  {
+    std::stringstream sstream;
+    sstream << GridLogMessage << "[" << action_name() << "] subgroups: " << nsplit << std::endl;
+    sstream << GridLogMessage << "[" << action_name() << "] subgroup " << split_rank << " actions:";
+    for (int a = 0; a < actions.size(); a++) sstream << " " << actions[a]->action_name();
+    sstream << std::endl;
+    return sstream.str();
+  }
+
+  // Seeds of one refresh, identical on every rank
+  static std::vector<int> RefreshSeeds(GridSerialRNG &sRNG)
+  {
+    std::vector<int> seeds(4);
+    for (int i = 0; i < seeds.size(); i++) {
+      RealD r;
+      random(sRNG, r);
+      seeds[i] = (int)(r * 2147483647.0);
+    }
+    return seeds;
+  }
+
+  // SeedFixedIntegers broadcasts its seeds from world rank 0, so it cannot
+  // tell the subgroups apart; seed each site generator locally instead
+  static void SeedSubgroup(GridParallelRNG &pRNG, const std::vector<int> &seeds, int subgroup)
+  {
+    GridBase *grid = pRNG.Grid();
+    thread_for( lidx, grid->lSites(), {
+      int64_t gidx;
+      int rank, o_idx, i_idx;
+      Coordinate pcoor, lcoor, gcoor;
+      grid->LocalIndexToLocalCoor(lidx, lcoor);
+      pcoor = grid->ThisProcessorCoor();
+      grid->ProcessorCoorLocalCoorToGlobalCoor(pcoor, lcoor, gcoor);
+      grid->GlobalCoorToGlobalIndex(gcoor, gidx);
+      grid->GlobalCoorToRankIndex(rank, o_idx, i_idx, gcoor);
+
+      std::vector<int> site_seeds(seeds);
+      site_seeds.push_back(subgroup);
+      site_seeds.push_back((int)(gidx & 0x7fffffff));
+      site_seeds.push_back((int)(gidx >> 31));
+      std::seed_seq src(site_seeds.begin(), site_seeds.end());
+      pRNG.Seed(src, pRNG.generator_idx(o_idx, i_idx));
+    });
+  }
+
+  virtual void refresh(const GaugeField &U, GridSerialRNG &sRNG, GridParallelRNG &pRNG)
+  {
+    std::vector<int> seeds = RefreshSeeds(sRNG);
+    sRNG_split.SeedFixedIntegers(seeds);
+    SeedSubgroup(pRNG_split, seeds, split_rank);
+
+    GaugeField U_split(SplitGrid);
+    split(U, U_split);
+    for (int a = 0; a < actions.size(); a++) {
+      actions[a]->refresh(U_split, sRNG_split, pRNG_split);
+    }
+  }
+
+  virtual RealD S(const GaugeField &U)
+  {
+    GaugeField U_split(SplitGrid);
+    split(U, U_split);
+    RealD mine = 0.0;
+    for (int a = 0; a < actions.size(); a++) mine += actions[a]->S(U_split);
+    return sum_subgroups(mine);
+  }
+
+  virtual RealD Sinitial(const GaugeField &U)
+  {
+    GaugeField U_split(SplitGrid);
+    split(U, U_split);
+    RealD mine = 0.0;
+    for (int a = 0; a < actions.size(); a++) mine += actions[a]->Sinitial(U_split);
+    return sum_subgroups(mine);
+  }
+
+  virtual void deriv(const GaugeField &U, GaugeField &dSdU)
+  {
+    GaugeField U_split(SplitGrid);
+    GaugeField F_split(SplitGrid);
+    GaugeField tmp(SplitGrid);
+    split(U, U_split);
+
+    F_split = Zero();
+    for (int a = 0; a < actions.size(); a++) {
+      actions[a]->deriv(U_split, tmp);
+      F_split = F_split + tmp;
+    }
+
+    std::vector<GaugeField> F_full(nsplit, FullGrid);
+    Grid_unsplit(F_full, F_split);
+    dSdU = F_full[0];
+    for (int s = 1; s < nsplit; s++) dSdU = dSdU + F_full[s];
+  }
+};
+
+////////////////////////////////////////////////////////////////////////
+// A higher representation action presented as a fundamental one, so that
+// it can be grouped in a ConcurrentAction with fundamental actions. The
+// force is projected back to the fundamental algebra as in update_P.
+////////////////////////////////////////////////////////////////////////
+template <class Rep>
+class RepresentationAction : public Action<LatticeGaugeField>
+{
+public:
+  typedef typename Rep::LatticeField RepField;
+
+private:
+  Rep R;
+  Action<RepField> &Act;
+
+public:
+  RepresentationAction(GridBase *grid, Action<RepField> &_Act) : R(grid), Act(_Act) {}
+
+  virtual std::string action_name()   { return Act.action_name(); }
+  virtual std::string LogParameters() { return Act.LogParameters(); }
+
+  virtual void refresh(const LatticeGaugeField &U, GridSerialRNG &sRNG, GridParallelRNG &pRNG)
+  {
+    R.update_representation(U);
+    Act.refresh(R.U, sRNG, pRNG);
+  }
+
+  virtual RealD S(const LatticeGaugeField &U)
+  {
+    R.update_representation(U);
+    return Act.S(R.U);
+  }
+
+  virtual RealD Sinitial(const LatticeGaugeField &U)
+  {
+    R.update_representation(U);
+    return Act.Sinitial(R.U);
+  }
+
+  virtual void deriv(const LatticeGaugeField &U, LatticeGaugeField &dSdU)
+  {
+    R.update_representation(U);
+    RepField forceR(U.Grid());
+    Act.deriv(R.U, forceR);
+    dSdU = R.RtoFundamentalProject(forceR);
+  }
+};
+
+NAMESPACE_END(Grid);
+
+#endif
@@ -130,6 +130,9 @@ typedef WilsonFermion<WilsonTwoIndexAntiSymmetricImplD> WilsonTwoIndexAntiSymmet
 typedef WilsonFermion<SpWilsonImplF> SpWilsonFermionF;
 typedef WilsonFermion<SpWilsonImplD> SpWilsonFermionD;
 
+typedef WilsonFermion<SpWilsonCompressedImplF> SpWilsonCompressedFermionF;
+typedef WilsonFermion<SpWilsonCompressedImplD> SpWilsonCompressedFermionD;
+
 typedef WilsonFermion<SpWilsonTwoIndexAntiSymmetricImplF> SpWilsonTwoIndexAntiSymmetricFermionF;
 typedef WilsonFermion<SpWilsonTwoIndexAntiSymmetricImplD> SpWilsonTwoIndexAntiSymmetricFermionD;
 
@@ -183,6 +186,25 @@ typedef CompactWilsonClover<WilsonTwoIndexSymmetricImplD> CompactWilsonCloverTwo
 typedef CompactWilsonClover<WilsonTwoIndexAntiSymmetricImplF> CompactWilsonCloverTwoIndexAntiSymmetricFermionF;
 typedef CompactWilsonClover<WilsonTwoIndexAntiSymmetricImplD> CompactWilsonCloverTwoIndexAntiSymmetricFermionD;
 
+// Sp(2n) clover fermions
+typedef WilsonClover<SpWilsonImplF> SpWilsonCloverFermionF;
+typedef WilsonClover<SpWilsonImplD> SpWilsonCloverFermionD;
+
+typedef WilsonClover<SpWilsonTwoIndexAntiSymmetricImplF> SpWilsonCloverTwoIndexAntiSymmetricFermionF;
+typedef WilsonClover<SpWilsonTwoIndexAntiSymmetricImplD> SpWilsonCloverTwoIndexAntiSymmetricFermionD;
+
+typedef WilsonClover<SpWilsonTwoIndexSymmetricImplF> SpWilsonCloverTwoIndexSymmetricFermionF;
+typedef WilsonClover<SpWilsonTwoIndexSymmetricImplD> SpWilsonCloverTwoIndexSymmetricFermionD;
+
+typedef CompactWilsonClover<SpWilsonImplF> SpCompactWilsonCloverFermionF;
+typedef CompactWilsonClover<SpWilsonImplD> SpCompactWilsonCloverFermionD;
+
+typedef CompactWilsonClover<SpWilsonTwoIndexAntiSymmetricImplF> SpCompactWilsonCloverTwoIndexAntiSymmetricFermionF;
+typedef CompactWilsonClover<SpWilsonTwoIndexAntiSymmetricImplD> SpCompactWilsonCloverTwoIndexAntiSymmetricFermionD;
+
+typedef CompactWilsonClover<SpWilsonTwoIndexSymmetricImplF> SpCompactWilsonCloverTwoIndexSymmetricFermionF;
+typedef CompactWilsonClover<SpWilsonTwoIndexSymmetricImplD> SpCompactWilsonCloverTwoIndexSymmetricFermionD;
+
 // Domain Wall fermions
 typedef DomainWallFermion<WilsonImplF> DomainWallFermionF;
 typedef DomainWallFermion<WilsonImplD> DomainWallFermionD;
@@ -167,6 +167,8 @@ NAMESPACE_CHECK(ImplBase);
 /////////////////////////////////////////////////////////////////////////////
 #include <Grid/qcd/action/fermion/WilsonImpl.h> 
 NAMESPACE_CHECK(ImplWilson);  
+#include <Grid/qcd/action/fermion/SpWilsonCompressedImpl.h> 
+NAMESPACE_CHECK(ImplSpWilsonCompressed);  
    
 ////////////////////////////////////////////////////////////////////////////////////////
 // Flavour doubled spinors; is Gparity the only? what about C*?
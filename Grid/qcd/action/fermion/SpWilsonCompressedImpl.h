@@ -0,0 +1,204 @@
+/*************************************************************************************
+
+Grid physics library, www.github.com/paboyle/Grid
+
+Source file: ./lib/qcd/action/fermion/SpWilsonCompressedImpl.h
+
+Copyright (C) 2015
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+See the full license in the file "LICENSE" in the top level distribution
+directory
+*************************************************************************************/
+			   /*  END LEGAL */
+#pragma once
+
+NAMESPACE_BEGIN(Grid);
+
+/////////////////////////////////////////////////////////////////////////////
+// Sp(2N) Wilson fermions with compressed double stored links.
+//
+// A link in the fundamental of Sp(2N) has the block form
+//
+//   U = (   A    B  )
+//       ( -B^*  A^* )
+//
+// so only the top N rows are stored; the bottom N rows are rebuilt in
+// registers in multLink. This halves the gauge field bandwidth of Dhop.
+// The block form survives the real rescaling and the +/-1 boundary phases
+// applied in DoubleStore, but not complex phases or twists.
+/////////////////////////////////////////////////////////////////////////////
+template <class S, class Representation = SpFundamentalRepresentation, class Options = CoeffReal>
+class SpWilsonCompressedImpl : public WilsonImpl<S, Representation, Options> {
+public:
+
+  typedef WilsonImpl<S, Representation, Options> Base;
+  INHERIT_GIMPL_TYPES(Base);
+
+  static const int Dimension = Representation::Dimension;
+  static const int Nhalf = Dimension / 2;
+  static_assert(Representation::isFundamental, "Compressed links require the fundamental representation");
+  static_assert(Dimension % 2 == 0, "Compressed links require an Sp(2N) gauge group");
+
+  template <typename vtype> using iImplDoubledGaugeField = iVector<iScalar<iVector<iVector<vtype, Dimension>, Nhalf> >, Nds>;
+
+  typedef iImplDoubledGaugeField<Simd> SiteDoubledGaugeField;
+  typedef Lattice<SiteDoubledGaugeField> DoubledGaugeField;
+
+  typedef typename Base::ImplParams ImplParams;
+
+  SpWilsonCompressedImpl(const ImplParams &p = ImplParams()) : Base(p) {};
+
+  // phi = U chi for one colour vector, with the bottom rows ( -B^* A^* )
+  // of U rebuilt from the stored top rows ( A B )
+  template<class Link, class vtype>
+  static accelerator_inline void multCompressedLink(iVector<vtype, Dimension> &phi,
+						    const Link &UU,
+						    const iVector<vtype, Dimension> &chi)
+  {
+    for (int i = 0; i < Nhalf; i++) {
+      auto top = UU()(i)(0) * chi(0);
+      auto bot = conjugate(UU()(i)(Nhalf)) * chi(0);
+      for (int j = 1; j < Dimension; j++) {
+	top = top + UU()(i)(j) * chi(j);
+      }
+      for (int j = 1; j < Nhalf; j++) {
+	bot = bot + conjugate(UU()(i)(j + Nhalf)) * chi(j);
+      }
+      bot = -bot;
+      for (int j = 0; j < Nhalf; j++) {
+	bot = bot + conjugate(UU()(i)(j)) * chi(j + Nhalf);
+      }
+      phi(i) = top;
+      phi(i + Nhalf) = bot;
+    }
+  }
+
+  template<class vtype, int Nspin>
+  static accelerator_inline void multLink(iScalar<iVector<iVector<vtype, Dimension>, Nspin> > &phi,
+					  const SiteDoubledGaugeField &U,
+					  const iScalar<iVector<iVector<vtype, Dimension>, Nspin> > &chi,
+					  int mu)
+  {
+    auto UU = coalescedRead(U(mu));
+    for (int s = 0; s < Nspin; s++) {
+      multCompressedLink(phi()(s), UU, chi()(s));
+    }
+  }
+
+  template<class vtype, int Nspin>
+  static accelerator_inline void multLink(iScalar<iMatrix<iMatrix<vtype, Dimension>, Nspin> > &phi,
+					  const SiteDoubledGaugeField &U,
+					  const iScalar<iMatrix<iMatrix<vtype, Dimension>, Nspin> > &chi,
+					  int mu)
+  {
+    auto UU = coalescedRead(U(mu));
+    iVector<vtype, Dimension> col, Ucol;
+    for (int s1 = 0; s1 < Nspin; s1++)
+    for (int s2 = 0; s2 < Nspin; s2++)
+    for (int k = 0; k < Dimension; k++) {
+      for (int j = 0; j < Dimension; j++) col(j) = chi()(s1, s2)(j, k);
+      multCompressedLink(Ucol, UU, col);
+      for (int i = 0; i < Dimension; i++) phi()(s1, s2)(i, k) = Ucol(i);
+    }
+  }
+
+  template<class _Spinor>
+  static accelerator_inline void multLink(_Spinor &phi,
+					  const SiteDoubledGaugeField &U,
+					  const _Spinor &chi,
+					  int mu,
+					  StencilEntry *SE,
+					  typename Base::StencilView &St)
+  {
+    multLink(phi,U,chi,mu);
+  }
+
+  template<class _SpinorField>
+  inline void multLinkField(_SpinorField & out,
+			    const DoubledGaugeField &Umu,
+			    const _SpinorField & phi,
+			    int mu)
+  {
+    const int Nsimd = Simd::Nsimd();
+    autoView( out_v, out, AcceleratorWrite);
+    autoView( phi_v, phi, AcceleratorRead);
+    autoView( Umu_v, Umu, AcceleratorRead);
+    typedef decltype(coalescedRead(out_v[0]))   calcSpinor;
+    accelerator_for(sss,out.Grid()->oSites(),Nsimd,{
+	calcSpinor tmp;
+	multLink(tmp,Umu_v[sss],phi_v(sss),mu);
+	coalescedWrite(out_v[sss],tmp);
+    });
+  }
+
+  inline void DoubleStore(GridBase *GaugeGrid,
+			  DoubledGaugeField &Uds,
+			  const GaugeField &Umu)
+  {
+    for (int mu = 0; mu < Nd; mu++) {
+      auto pha = this->Params.boundary_phases[mu];
+      assert(imag(pha) == 0.0 && "Compressed Sp links require real boundary phases");
+      assert(this->Params.twist_n_2pi_L[mu] == 0.0 && "Compressed Sp links do not support twists");
+    }
+
+    // Build the full links with the usual boundary conditions, then keep
+    // the independent half only
+    typename Base::DoubledGaugeField Ufull(GaugeGrid);
+    Base::DoubleStore(GaugeGrid, Ufull, Umu);
+
+    autoView( Uds_v, Uds, AcceleratorWrite);
+    autoView( Ufull_v, Ufull, AcceleratorRead);
+    accelerator_for(ss, GaugeGrid->oSites(), Simd::Nsimd(), {
+      for (int mu = 0; mu < Nds; mu++) {
+	auto Ufull_s = coalescedRead(Ufull_v[ss](mu));
+	typedef decltype(coalescedRead(Uds_v[0](0))) CompressedLink;
+	CompressedLink Uc;
+	for (int i = 0; i < Nhalf; i++)
+	for (int j = 0; j < Dimension; j++)
+	  Uc()(i)(j) = Ufull_s()(i, j);
+	coalescedWrite(Uds_v[ss](mu), Uc);
+      }
+    });
+  }
+
+  inline void extractLinkField(std::vector<GaugeLinkField> &mat, DoubledGaugeField &Uds)
+  {
+    for (int mu = 0; mu < Nd; mu++) {
+      autoView( mat_v, mat[mu], AcceleratorWrite);
+      autoView( Uds_v, Uds, AcceleratorRead);
+      accelerator_for(ss, Uds.Grid()->oSites(), Simd::Nsimd(), {
+	auto Uc = coalescedRead(Uds_v[ss](mu));
+	typedef decltype(coalescedRead(mat_v[0])) LinkType;
+	LinkType U;
+	for (int i = 0; i < Nhalf; i++)
+	for (int j = 0; j < Nhalf; j++) {
+	  U()()(i, j)                 = Uc()(i)(j);
+	  U()()(i, j + Nhalf)         = Uc()(i)(j + Nhalf);
+	  U()()(i + Nhalf, j)         = -conjugate(Uc()(i)(j + Nhalf));
+	  U()()(i + Nhalf, j + Nhalf) = conjugate(Uc()(i)(j));
+	}
+	coalescedWrite(mat_v[ss], U);
+      });
+    }
+  }
+};
+
+typedef SpWilsonCompressedImpl<vComplex,  SpFundamentalRepresentation, CoeffReal > SpWilsonCompressedImplR;  // Real.. whichever prec
+typedef SpWilsonCompressedImpl<vComplexF, SpFundamentalRepresentation, CoeffReal > SpWilsonCompressedImplF;  // Float
+typedef SpWilsonCompressedImpl<vComplexD, SpFundamentalRepresentation, CoeffReal > SpWilsonCompressedImplD;  // Double
+
+NAMESPACE_END(Grid);
@@ -275,11 +275,11 @@ public:
       for(int block=0; block<Nhs; block++) {
         int s_start = block*Nhs;
         for(int i=0; i<Nred; i++) {
-          int si = s_start + i/Nc, ci = i%Nc;
+          int si = s_start + i/Nrep, ci = i%Nrep;
           res()(si)(ci) = diagonal_t()(block)(i) * in_t()(si)(ci);
           for(int j=0; j<Nred; j++) {
             if (j == i) continue;
-            int sj = s_start + j/Nc, cj = j%Nc;
+            int sj = s_start + j/Nrep, cj = j%Nrep;
             res()(si)(ci) = res()(si)(ci) + triangle_elem(triangle_t, block, i, j) * in_t()(sj)(cj);
           };
         };
@@ -506,7 +506,9 @@ public:
 #if defined(GRID_CUDA) || defined(GRID_HIP)
     MooeeKernel_gpu(Nsite, Ls, in, out, diagonal, triangle);
 #else
-    MooeeKernel_cpu(Nsite, Ls, in, out, diagonal, triangle);
+    // The cpu kernel is unrolled for three colours; other representations take the generic loop
+    if constexpr (Nrep == 3) MooeeKernel_cpu(Nsite, Ls, in, out, diagonal, triangle);
+    else                     MooeeKernel_gpu(Nsite, Ls, in, out, diagonal, triangle);
 #endif
   }
 
@@ -534,8 +536,8 @@ public:
     autoView(triangleInv_v, triangleInv, CpuWrite);
 
     thread_for(site, lsites, { // NOTE: Not on GPU because of Eigen & (peek/poke)LocalSite
-      Eigen::MatrixXcd clover_inv_eigen = Eigen::MatrixXcd::Zero(Ns*Nc, Ns*Nc);
-      Eigen::MatrixXcd clover_eigen = Eigen::MatrixXcd::Zero(Ns*Nc, Ns*Nc);
+      Eigen::MatrixXcd clover_inv_eigen = Eigen::MatrixXcd::Zero(Nred, Nred);
+      Eigen::MatrixXcd clover_eigen = Eigen::MatrixXcd::Zero(Nred, Nred);
 
       scalar_object_diagonal diagonal_tmp     = Zero();
       scalar_object_diagonal diagonal_inv_tmp = Zero();
@@ -548,45 +550,23 @@ public:
       peekLocalSite(diagonal_tmp, diagonal_v, lcoor);
       peekLocalSite(triangle_tmp, triangle_v, lcoor);
 
-      // TODO: can we save time here by inverting the two 6x6 hermitian matrices separately?
-      for (long s_row=0;s_row<Ns;s_row++) {
-        for (long s_col=0;s_col<Ns;s_col++) {
-          if(abs(s_row - s_col) > 1 || s_row + s_col == 3) continue;
-          int block       = s_row / Nhs;
-          int s_row_block = s_row % Nhs;
-          int s_col_block = s_col % Nhs;
-          for (long c_row=0;c_row<Nc;c_row++) {
-            for (long c_col=0;c_col<Nc;c_col++) {
-              int i = s_row_block * Nc + c_row;
-              int j = s_col_block * Nc + c_col;
-              if(i == j)
-                clover_eigen(s_row*Nc+c_row, s_col*Nc+c_col) = static_cast<ComplexD>(TensorRemove(diagonal_tmp()(block)(i)));
-              else
-                clover_eigen(s_row*Nc+c_row, s_col*Nc+c_col) = static_cast<ComplexD>(TensorRemove(triangle_elem(triangle_tmp, block, i, j)));
-            }
+      // The clover term is block diagonal in chirality: invert the two Nred x Nred blocks separately
+      for (int block=0;block<Nblock;block++) {
+        for (int i=0;i<Nred;i++) {
+          for (int j=0;j<Nred;j++) {
+            if(i == j)
+              clover_eigen(i, j) = static_cast<ComplexD>(TensorRemove(diagonal_tmp()(block)(i)));
+            else
+              clover_eigen(i, j) = static_cast<ComplexD>(TensorRemove(triangle_elem(triangle_tmp, block, i, j)));
           }
         }
-      }
 
-      clover_inv_eigen = clover_eigen.inverse();
+        clover_inv_eigen = clover_eigen.inverse();
 
-      for (long s_row=0;s_row<Ns;s_row++) {
-        for (long s_col=0;s_col<Ns;s_col++) {
-          if(abs(s_row - s_col) > 1 || s_row + s_col == 3) continue;
-          int block       = s_row / Nhs;
-          int s_row_block = s_row % Nhs;
-          int s_col_block = s_col % Nhs;
-          for (long c_row=0;c_row<Nc;c_row++) {
-            for (long c_col=0;c_col<Nc;c_col++) {
-              int i = s_row_block * Nc + c_row;
-              int j = s_col_block * Nc + c_col;
-              if(i == j)
-                diagonal_inv_tmp()(block)(i) = clover_inv_eigen(s_row*Nc+c_row, s_col*Nc+c_col);
-              else if(i < j)
-                triangle_inv_tmp()(block)(triangle_index(i, j)) = clover_inv_eigen(s_row*Nc+c_row, s_col*Nc+c_col);
-              else
-                continue;
-            }
+        for (int i=0;i<Nred;i++) {
+          diagonal_inv_tmp()(block)(i) = clover_inv_eigen(i, i);
+          for (int j=i+1;j<Nred;j++) {
+            triangle_inv_tmp()(block)(triangle_index(i, j)) = clover_inv_eigen(i, j);
           }
         }
       }
@@ -617,10 +597,10 @@ public:
           int block       = s_row / Nhs;
           int s_row_block = s_row % Nhs;
           int s_col_block = s_col % Nhs;
-          for(int c_row = 0; c_row < Nc; c_row++) {
-            for(int c_col = 0; c_col < Nc; c_col++) {
-              int i = s_row_block * Nc + c_row;
-              int j = s_col_block * Nc + c_col;
+          for(int c_row = 0; c_row < Nrep; c_row++) {
+            for(int c_col = 0; c_col < Nrep; c_col++) {
+              int i = s_row_block * Nrep + c_row;
+              int j = s_col_block * Nrep + c_col;
               if(i == j)
                 diagonal_v[ss]()(block)(i) = full_v[ss]()(s_row, s_col)(c_row, c_col);
               else if(i < j)
@@ -657,10 +637,10 @@ public:
           int block       = s_row / Nhs;
           int s_row_block = s_row % Nhs;
           int s_col_block = s_col % Nhs;
-          for(int c_row = 0; c_row < Nc; c_row++) {
-            for(int c_col = 0; c_col < Nc; c_col++) {
-              int i = s_row_block * Nc + c_row;
-              int j = s_col_block * Nc + c_col;
+          for(int c_row = 0; c_row < Nrep; c_row++) {
+            for(int c_col = 0; c_col < Nrep; c_col++) {
+              int i = s_row_block * Nrep + c_row;
+              int j = s_col_block * Nrep + c_col;
               if(i == j)
                 full_v[ss]()(s_row, s_col)(c_row, c_col) = diagonal_v[ss]()(block)(i);
               else
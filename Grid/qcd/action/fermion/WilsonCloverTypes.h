@@ -47,10 +47,11 @@ class CompactWilsonCloverTypes {
 public:
   INHERIT_IMPL_TYPES(Impl);
 
-  static constexpr int Nred      = Nc * Nhs;        // 6
-  static constexpr int Nblock    = Nhs;             // 2
-  static constexpr int Ndiagonal = Nred;            // 6
-  static constexpr int Ntriangle = (Nred - 1) * Nc; // 15
+  static constexpr int Nrep      = Impl::Dimension;      // 3 for SU(3) fundamental
+  static constexpr int Nred      = Nrep * Nhs;           // 6
+  static constexpr int Nblock    = Nhs;                  // 2
+  static constexpr int Ndiagonal = Nred;                 // 6
+  static constexpr int Ntriangle = Nred*(Nred - 1) / 2;  // 15
 
   template<typename vtype> using iImplCloverDiagonal = iScalar<iVector<iVector<vtype, Ndiagonal>, Nblock>>;
   template<typename vtype> using iImplCloverTriangle = iScalar<iVector<iVector<vtype, Ntriangle>, Nblock>>;
@@ -82,6 +83,7 @@ public:
     iScalar<iVector<iVector<vtype, CompactWilsonCloverTypes<Impl>::Ntriangle>, CompactWilsonCloverTypes<Impl>::Nblock>>;
 
 #define INHERIT_COMPACT_CLOVER_SIZES(Impl)                                    \
+  static constexpr int Nrep      = CompactWilsonCloverTypes<Impl>::Nrep;      \
   static constexpr int Nred      = CompactWilsonCloverTypes<Impl>::Nred;      \
   static constexpr int Nblock    = CompactWilsonCloverTypes<Impl>::Nblock;    \
   static constexpr int Ndiagonal = CompactWilsonCloverTypes<Impl>::Ndiagonal; \
@@ -0,0 +1 @@
+../WilsonKernelsInstantiationSpCompressed.cc.master
\ No newline at end of file
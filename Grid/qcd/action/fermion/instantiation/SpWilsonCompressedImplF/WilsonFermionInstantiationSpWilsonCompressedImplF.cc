@@ -0,0 +1 @@
+../WilsonFermionInstantiation.cc.master
\ No newline at end of file
@@ -0,0 +1 @@
+../CompactWilsonCloverFermionInstantiation.cc.master
\ No newline at end of file
@@ -25,9 +25,25 @@ WILSON_IMPL_LIST=" \
 	   GparityWilsonImplF \
 	   GparityWilsonImplD "
 
+SP_COMPRESSED_IMPL_LIST=" \
+	   SpWilsonCompressedImplF \
+	   SpWilsonCompressedImplD "
+
 COMPACT_WILSON_IMPL_LIST=" \
 	   WilsonImplF \
-	   WilsonImplD "
+	   WilsonImplD \
+	   SpWilsonImplF \
+	   SpWilsonImplD \
+	   WilsonAdjImplF \
+	   WilsonAdjImplD \
+	   WilsonTwoIndexSymmetricImplF \
+	   WilsonTwoIndexSymmetricImplD \
+	   WilsonTwoIndexAntiSymmetricImplF \
+	   WilsonTwoIndexAntiSymmetricImplD \
+	   SpWilsonTwoIndexAntiSymmetricImplF \
+	   SpWilsonTwoIndexAntiSymmetricImplD \
+	   SpWilsonTwoIndexSymmetricImplF \
+	   SpWilsonTwoIndexSymmetricImplD "
 
 DWF_IMPL_LIST=" \
 	   WilsonImplF \
@@ -42,7 +58,7 @@ GDWF_IMPL_LIST=" \
 	   GparityWilsonImplF \
 	   GparityWilsonImplD "
 
-IMPL_LIST="$STAG_IMPL_LIST  $WILSON_IMPL_LIST $DWF_IMPL_LIST $GDWF_IMPL_LIST"
+IMPL_LIST="$STAG_IMPL_LIST  $WILSON_IMPL_LIST $SP_COMPRESSED_IMPL_LIST $DWF_IMPL_LIST $GDWF_IMPL_LIST"
 
 for impl in $IMPL_LIST
 do
@@ -64,6 +80,13 @@ do
 done
 done
 
+# compressed Sp(2N) links: Wilson operator only, hand kernels forward to generic
+for impl in $SP_COMPRESSED_IMPL_LIST
+do
+  ln -f -s ../WilsonFermionInstantiation.cc.master $impl/WilsonFermionInstantiation$impl.cc
+  ln -f -s ../WilsonKernelsInstantiationSpCompressed.cc.master $impl/WilsonKernelsInstantiation$impl.cc
+done
+
 CC_LIST="CompactWilsonCloverFermionInstantiation"
 
 for impl in $COMPACT_WILSON_IMPL_LIST
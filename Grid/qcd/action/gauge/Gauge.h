@@ -51,6 +51,22 @@ typedef IwasakiGaugeAction<PeriodicGimplD>         IwasakiGaugeActionD;
 typedef SymanzikGaugeAction<PeriodicGimplR>        SymanzikGaugeActionR;
 typedef SymanzikGaugeAction<PeriodicGimplF>        SymanzikGaugeActionF;
 typedef SymanzikGaugeAction<PeriodicGimplD>        SymanzikGaugeActionD;
+typedef DBW2GaugeAction<PeriodicGimplR>            DBW2GaugeActionR;
+typedef DBW2GaugeAction<PeriodicGimplF>            DBW2GaugeActionF;
+typedef DBW2GaugeAction<PeriodicGimplD>            DBW2GaugeActionD;
+
+typedef PlaqPlusRectangleAction<SpPeriodicGimplR>  SpPlaqPlusRectangleActionR;
+typedef PlaqPlusRectangleAction<SpPeriodicGimplF>  SpPlaqPlusRectangleActionF;
+typedef PlaqPlusRectangleAction<SpPeriodicGimplD>  SpPlaqPlusRectangleActionD;
+typedef IwasakiGaugeAction<SpPeriodicGimplR>       SpIwasakiGaugeActionR;
+typedef IwasakiGaugeAction<SpPeriodicGimplF>       SpIwasakiGaugeActionF;
+typedef IwasakiGaugeAction<SpPeriodicGimplD>       SpIwasakiGaugeActionD;
+typedef SymanzikGaugeAction<SpPeriodicGimplR>      SpSymanzikGaugeActionR;
+typedef SymanzikGaugeAction<SpPeriodicGimplF>      SpSymanzikGaugeActionF;
+typedef SymanzikGaugeAction<SpPeriodicGimplD>      SpSymanzikGaugeActionD;
+typedef DBW2GaugeAction<SpPeriodicGimplR>          SpDBW2GaugeActionR;
+typedef DBW2GaugeAction<SpPeriodicGimplF>          SpDBW2GaugeActionF;
+typedef DBW2GaugeAction<SpPeriodicGimplD>          SpDBW2GaugeActionD;
 
 
 typedef WilsonGaugeAction<ConjugateGimplR>          ConjugateWilsonGaugeActionR;
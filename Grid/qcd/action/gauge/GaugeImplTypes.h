@@ -60,7 +60,8 @@ NAMESPACE_BEGIN(Grid);
   typedef typename Impl::SiteField SiteField;	    \
   typedef typename Impl::Field Field;
 
-// hardcodes the exponential approximation in the template
+// Nexp is the Taylor order of the truncated Exponentiate; update_field uses
+// the working precision ExponentiateExact and does not depend on it
 template <class S, int Nrepresentation = Nc, int Nexp = 12, class Group = SU<Nc> > class GaugeImplTypes {
 public:
   typedef S Simd;
@@ -115,15 +116,10 @@ public:
     //
     // Must scale the momentum by sqrt(2) to invoke CPS and UKQCD conventions
     //
-    LinkField Pmu(P.Grid());
-    Pmu = Zero();
-
-    for (int mu = 0; mu < Nd; mu++) {
-      Group::GaussianFundamentalLieAlgebraMatrix(pRNG, Pmu);
-      RealD scale = ::sqrt(HMC_MOMENTUM_DENOMINATOR) ;
-      Pmu = Pmu*scale;
-      PokeIndex<LorentzIndex>(P, Pmu, mu);
-    }
+    // All directions in one pass; same random numbers as drawing each Pmu
+    // with GaussianFundamentalLieAlgebraMatrix in turn
+    RealD scale = ::sqrt(HMC_MOMENTUM_DENOMINATOR) ;
+    Group::GaussianFundamentalLieAlgebraMatrix(pRNG, P, 1.0, scale);
   }
     
   static inline Field projectForce(Field &P) {
@@ -140,8 +136,9 @@ public:
     autoView(P_v,P,AcceleratorRead);
     accelerator_for(ss, P.Grid()->oSites(),1,{
       for (int mu = 0; mu < Nd; mu++) {
-          U_v[ss](mu) = Exponentiate(P_v[ss](mu), ep, Nexp) * U_v[ss](mu);
-          U_v[ss](mu) = Group::ProjectOnGeneralGroup(U_v[ss](mu));
+          // exp of an algebra element is in the group to rounding, so no
+          // reprojection is needed after the update
+          U_v[ss](mu) = ExponentiateExact(P_v[ss](mu), ep) * U_v[ss](mu);
       }
     });
    //auto end = std::chrono::high_resolution_clock::now();
@@ -86,11 +86,12 @@ public:
     WilsonLoops<Gimpl>::StapleAndRectStapleAll(Staple, RectStaple, U, workspace);
 
     GaugeLinkField dSdU_mu(grid);
-    GaugeLinkField staple(grid);
 
+    // Ta is linear: combine the staples first and project once per link.
+    // Both Ta and the coefficients are group agnostic, so this serves SU(N)
+    // and Sp(2N) gimpls alike; the integrator applies the group projection.
     for (int mu=0; mu < Nd; mu++){
-      dSdU_mu = Ta(U[mu]*Staple[mu])*factor_p;
-      dSdU_mu = dSdU_mu + Ta(U[mu]*RectStaple[mu])*factor_r;
+      dSdU_mu = Ta(U[mu]*(Staple[mu]*factor_p + RectStaple[mu]*factor_r));
 	  
       PokeIndex<LorentzIndex>(dSdU, dSdU_mu, mu);
     }
@@ -49,6 +49,8 @@ private:
 
   FermionField Phi;  // the pseudo fermion field for this trajectory
 
+  ChronoSolutionHistory<FermionField> DerivativeHistory; // guesses for the force solves
+
 public:
   /////////////////////////////////////////////////
   // Pass in required objects.
@@ -61,6 +63,9 @@ public:
       ActionSolver(AS),
       Phi(Op.FermionGrid()){};
 
+  // Chronological initial guess from the last degree force solves; 0 disables
+  void setChronoForecastDegree(int degree) { DerivativeHistory.setMaxDegree(degree); }
+
 
   virtual std::string action_name(){return "TwoFlavourPseudoFermionAction";}
 
@@ -98,6 +103,8 @@ public:
 
     FermOp.ImportGauge(U);
     FermOp.Mdag(eta, Phi);
+
+    DerivativeHistory.clear();
   };
 
   //////////////////////////////////////////////////////
@@ -137,8 +144,9 @@ public:
 
     MdagMLinearOperator<FermionOperator<Impl>, FermionField> MdagMOp(FermOp);
 
-    X = Zero();
+    DerivativeHistory.Guess(MdagMOp, Phi, X);
     DerivativeSolver(MdagMOp, Phi, X); // X = (MdagM)^-1 phi    
+    DerivativeHistory.Update(X);
     MdagMOp.Op(X, Y);                  // Y = M X = (Mdag)^-1 phi
 
     // Our conventions really make this UdSdU; We do not differentiate wrt Udag here.
@@ -51,6 +51,8 @@ private:
   FermionField PhiOdd;   // the pseudo fermion field for this trajectory
   FermionField PhiEven;  // the pseudo fermion field for this trajectory
 
+  ChronoSolutionHistory<FermionField> DerivativeHistory; // guesses for the force solves
+
 public:
   /////////////////////////////////////////////////
   // Pass in required objects.
@@ -64,6 +66,9 @@ public:
       PhiEven(Op.FermionRedBlackGrid()),
       PhiOdd(Op.FermionRedBlackGrid())
   {};
+
+  // Chronological initial guess from the last degree force solves; 0 disables
+  void setChronoForecastDegree(int degree) { DerivativeHistory.setMaxDegree(degree); }
   
   virtual std::string action_name(){return "TwoFlavourEvenOddPseudoFermionAction";}
       
@@ -105,7 +110,8 @@ public:
     
     PhiOdd =PhiOdd*scale;
     PhiEven=PhiEven*scale;
-    
+
+    DerivativeHistory.clear();
   };
   
   //////////////////////////////////////////////////////
@@ -155,8 +161,9 @@ public:
     // Our conventions really make this UdSdU; We do not differentiate wrt Udag here.
     // So must take dSdU - adj(dSdU) and left multiply by mom to get dS/dt.
 
-    X=Zero();
+    DerivativeHistory.Guess(Mpc,PhiOdd,X);
     DerivativeSolver(Mpc,PhiOdd,X);
+    DerivativeHistory.Update(X);
     Mpc.Mpc(X,Y);
     Mpc.MpcDeriv(tmp , Y, X );    dSdU=tmp;
     Mpc.MpcDagDeriv(tmp , X, Y);  dSdU=dSdU+tmp;
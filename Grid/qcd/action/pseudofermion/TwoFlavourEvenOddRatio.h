@@ -51,6 +51,8 @@ NAMESPACE_BEGIN(Grid);
       FermionField PhiEven;  // the pseudo fermion field for this trajectory
 
       RealD RefreshAction;
+
+      ChronoSolutionHistory<FermionField> DerivativeHistory; // guesses for the force solves
       
     public:
       TwoFlavourEvenOddRatioPseudoFermionAction(FermionOperator<Impl>  &_NumOp, 
@@ -92,6 +94,9 @@ NAMESPACE_BEGIN(Grid);
       
       const FermionField &getPhiOdd() const{ return PhiOdd; }
 
+      // Chronological initial guess from the last degree force solves; 0 disables
+      void setChronoForecastDegree(int degree) { DerivativeHistory.setMaxDegree(degree); }
+
       virtual void refresh(const GaugeField &U, GridSerialRNG &sRNG, GridParallelRNG& pRNG) {
         // P(eta_o) = e^{- eta_o^dag eta_o}
         //
@@ -143,6 +148,7 @@ NAMESPACE_BEGIN(Grid);
 	std::cout << " TwoFlavourRefresh: Mee "<<std::endl;
 
 	RefreshAction = norm2(etaEven)+norm2(etaOdd);
+	DerivativeHistory.clear();
 	std::cout << " refresh " <<action_name()<< " action "<<RefreshAction<<std::endl;
       };
 
@@ -208,8 +214,9 @@ NAMESPACE_BEGIN(Grid);
         //Y = (Mdag)^-1 V^dag  phi
         Vpc.MpcDag(PhiOdd,Y);          // Y= Vdag phi
 	std::cout << GridLogMessage <<" Y "<<norm2(Y)<<std::endl;
-        X=Zero();
+        DerivativeHistory.Guess(Mpc,Y,X);
         DerivativeSolver(Mpc,Y,X);     // X= (MdagM)^-1 Vdag phi
+        DerivativeHistory.Update(X);
 	std::cout << GridLogMessage <<" X "<<norm2(X)<<std::endl;
         Mpc.Mpc(X,Y);                  // Y=  Mdag^-1 Vdag phi
 	std::cout << GridLogMessage <<" Y "<<norm2(Y)<<std::endl;
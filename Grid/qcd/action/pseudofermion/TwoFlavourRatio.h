@@ -49,12 +49,17 @@ private:
 
   FermionField Phi; // the pseudo fermion field for this trajectory
 
+  ChronoSolutionHistory<FermionField> DerivativeHistory; // guesses for the force solves
+
 public:
   TwoFlavourRatioPseudoFermionAction(FermionOperator<Impl>  &_NumOp, 
 				     FermionOperator<Impl>  &_DenOp, 
 				     OperatorFunction<FermionField> & DS,
 				     OperatorFunction<FermionField> & AS
 				     ) : NumOp(_NumOp), DenOp(_DenOp), DerivativeSolver(DS), ActionSolver(AS), Phi(_NumOp.FermionGrid()) {};
+
+  // Chronological initial guess from the last degree force solves; 0 disables
+  void setChronoForecastDegree(int degree) { DerivativeHistory.setMaxDegree(degree); }
       
   virtual std::string action_name(){return "TwoFlavourRatioPseudoFermionAction";}
 
@@ -99,6 +104,8 @@ public:
     NumOp.M(tmp,Phi);               // Vdag^-1 Mdag eta
 
     Phi=Phi*scale;
+
+    DerivativeHistory.clear();
 	
   };
 
@@ -147,8 +154,9 @@ public:
     //X = (Mdag M)^-1 V^dag phi
     //Y = (Mdag)^-1 V^dag  phi
     NumOp.Mdag(Phi,Y);              // Y= Vdag phi
-    X=Zero();
+    DerivativeHistory.Guess(MdagMOp,Y,X);
     DerivativeSolver(MdagMOp,Y,X);      // X= (MdagM)^-1 Vdag phi
+    DerivativeHistory.Update(X);
     DenOp.M(X,Y);                  // Y=  Mdag^-1 Vdag phi
 
     // phi^dag V (Mdag M)^-1 dV^dag  phi
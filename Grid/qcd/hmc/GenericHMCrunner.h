@@ -54,6 +54,8 @@ public:
 
   HMCparameters Parameters;
   std::string ParameterFile;
+  std::string TrajectoryLog;  // JSON Lines per trajectory record, set by --TrajectoryLog
+  int ForceDiagnostics = 1;   // force statistics every k-th update_P, 0 off, set by --ForceDiagnostics
   HMCResourceManager<Implementation> Resources;
 
   // The set of actions (keep here for lower level users, for now)
@@ -120,6 +122,17 @@ public:
       arg = GridCmdOptionPayload(argv, argv + argc, "--ParameterFile");
       ParameterFile = arg;
     }
+    if (GridCmdOptionExists(argv, argv + argc, "--TrajectoryLog")) {
+      TrajectoryLog = GridCmdOptionPayload(argv, argv + argc, "--TrajectoryLog");
+      std::cout << GridLogMessage<<" GenericHMCrunner --TrajectoryLog "<<TrajectoryLog<<std::endl;
+    }
+    if (GridCmdOptionExists(argv, argv + argc, "--ForceDiagnostics")) {
+      arg = GridCmdOptionPayload(argv, argv + argc, "--ForceDiagnostics");
+      std::vector<int> ivec(0);
+      GridCmdOptionIntVector(arg, ivec);
+      ForceDiagnostics = ivec[0];
+      std::cout << GridLogMessage<<" GenericHMCrunner --ForceDiagnostics "<<ForceDiagnostics<<std::endl;
+    }
   }
 
 
@@ -192,6 +205,7 @@ private:
 
     // Sets the momentum filter
     MDynamics.setMomentumFilter(*(Resources.GetMomentumFilter()));
+    MDynamics.setForceDiagnostics(ForceDiagnostics);
 
     Smearing.set_Field(U);
 
@@ -199,9 +213,13 @@ private:
                                         Resources.GetSerialRNG(),
                                         Resources.GetParallelRNG(), 
                                         Resources.GetObservables(), U);
+    HMC.SetTrajectoryLog(TrajectoryLog);
 
     // Run it
     HMC.evolve();
+
+    // Last checkpoint may still be writing
+    Resources.GetCheckPointer()->WaitForCompletion();
   }
 };
 
@@ -92,6 +92,8 @@ struct HMCparameters: Serializable {
   
 };
 	
+template <class Impl> class BaseHmcCheckpointer;
+
 template <class IntegratorType>
 class HybridMonteCarlo {
 private:
@@ -110,6 +112,21 @@ private:
   IntegratorType &TheIntegrator;
   ObsListType Observables;
 
+  std::string TrajectoryLogFile; // JSON Lines, one record per trajectory; empty disables
+  RealD H0, H1;
+
+  /////////////////////////////////////////////////////////
+  // Plaquette for the trajectory log, gauge fields only
+  /////////////////////////////////////////////////////////
+  template <class Impl>
+  static auto log_plaquette(json &record, const Field &U, int)
+    -> decltype(typename Impl::LinkField(U.Grid()), void())
+  {
+    record["plaquette"] = WilsonLoops<Impl>::avgPlaquette(U);
+  }
+  template <class Impl>
+  static void log_plaquette(json &record, const Field &U, long) {}
+
   /////////////////////////////////////////////////////////
   // Metropolis step
   /////////////////////////////////////////////////////////
@@ -190,7 +207,7 @@ private:
     //////////////////////////////////////////////////////////////////////////////////////////////////////
     std::cout << GridLogMessage << "--------------------------------------------------\n";
     std::cout << GridLogMessage << "Compute initial action";
-    RealD H0 = TheIntegrator.Sinitial(U);  
+    H0 = TheIntegrator.Sinitial(U);  
     std::cout << GridLogMessage << "--------------------------------------------------\n";
 
     std::streamsize current_precision = std::cout.precision();
@@ -208,7 +225,7 @@ private:
     //////////////////////////////////////////////////////////////////////////////////////////////////////
     std::cout << GridLogMessage << "--------------------------------------------------\n";
     std::cout << GridLogMessage << "Compute final action";
-    RealD H1 = TheIntegrator.S(U);  
+    H1 = TheIntegrator.S(U);  
     std::cout << GridLogMessage << "--------------------------------------------------\n";
 
 
@@ -245,6 +262,8 @@ public:
     : Params(_Pams), TheIntegrator(_Int), sRNG(_sRNG), pRNG(_pRNG), Observables(_Obs), Ucur(_U) {}
   ~HybridMonteCarlo(){};
 
+  void SetTrajectoryLog(const std::string &file) { TrajectoryLogFile = file; }
+
   void evolve(void) {
     Real DeltaH;
 
@@ -260,6 +279,11 @@ public:
 
       std::cout << GridLogHMC << "-- # Trajectory = " << traj << "\n";
 
+      uint64_t dirichlet0, partial0, full0, bytes0, solves0, iters0;
+      DslashGetCounts(dirichlet0,partial0,full0);
+      DslashGetCommsBytes(bytes0);
+      SolverGetCounts(solves0,iters0);
+
       if (traj < Params.StartTrajectory + Params.NoMetropolisUntil) {
       	std::cout << GridLogHMC << "-- Thermalization" << std::endl;
       }
@@ -285,11 +309,61 @@ public:
       TheIntegrator.print_timer();
       
       TheIntegrator.Smearer.set_Field(Ucur);
+      double checkpoint_us = 0.0;
+      double observables_us = 0.0;
       for (int obs = 0; obs < Observables.size(); obs++) {
       	std::cout << GridLogDebug << "Observables # " << obs << std::endl;
       	std::cout << GridLogDebug << "Observables total " << Observables.size() << std::endl;
       	std::cout << GridLogDebug << "Observables pointer " << Observables[obs] << std::endl;
+	double o0 = usecond();
         Observables[obs]->TrajectoryComplete(traj + 1, TheIntegrator.Smearer, sRNG, pRNG);
+	double o1 = usecond();
+	if ( dynamic_cast<BaseHmcCheckpointer<FieldImplementation> *>(Observables[obs]) ) checkpoint_us += o1-o0;
+	else                                                                              observables_us += o1-o0;
+      }
+
+      if ( TrajectoryLogFile.size() ) {
+	json record;
+	record["trajectory"]  = traj;
+	record["accept"]      = accept;
+	record["H0"]          = H0;
+	record["H1"]          = H1;
+	record["dH"]          = DeltaH;
+	log_plaquette<FieldImplementation>(record, Ucur, 0);
+	record["time_s"]      = (t1-t0)*1.0e-6;
+	record["checkpoint_s"]  = checkpoint_us*1.0e-6;
+	record["observables_s"] = observables_us*1.0e-6;
+	record["actions"]     = TheIntegrator.json_timer();
+
+	uint64_t dirichlet, partial, full, bytes, solves, iters;
+	DslashGetCounts(dirichlet,partial,full);
+	DslashGetCommsBytes(bytes);
+	SolverGetCounts(solves,iters);
+	bytes = bytes - bytes0;
+	Ucur.Grid()->GlobalSum(bytes);
+	record["dslash"]      = { {"full", full-full0}, {"partial", partial-partial0}, {"dirichlet", dirichlet-dirichlet0} };
+	record["comms_bytes"] = bytes;
+	record["solver"]      = { {"solves", solves-solves0}, {"iterations", iters-iters0} };
+
+	MemoryStatus mem = MemoryManager::GetFootprint();
+	record["memory"]      = { {"DeviceBytes", mem.DeviceBytes},
+				  {"DeviceMaxBytes", mem.DeviceMaxBytes},
+				  {"DeviceLRUBytes", mem.DeviceLRUBytes},
+				  {"HostToDeviceBytes", mem.HostToDeviceBytes},
+				  {"DeviceToHostBytes", mem.DeviceToHostBytes},
+				  {"DeviceEvictions", mem.DeviceEvictions},
+				  {"DeviceAllocCacheBytes", mem.DeviceAllocCacheBytes},
+				  {"HostAllocCacheBytes", mem.HostAllocCacheBytes},
+				  {"HostHighWaterBytes", mem.HostHighWaterBytes},
+				  {"HostPoolHits", mem.HostPoolHits},
+				  {"HostPoolMisses", mem.HostPoolMisses},
+				  {"HostPoolFreeBytes", mem.HostPoolFreeBytes},
+				  {"HostPoolWasteBytes", mem.HostPoolWasteBytes} };
+
+	if ( Ucur.Grid()->IsBoss() ) {
+	  std::ofstream fout(TrajectoryLogFile, std::ios::app);
+	  fout << record.dump() << std::endl;
+	}
       }
       std::cout << GridLogHMC << ":::::::::::::::::::::::::::::::::::::::::::" << std::endl;
     }
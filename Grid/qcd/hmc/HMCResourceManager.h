@@ -286,6 +286,7 @@ public:
   }
 
   RegisterLoadCheckPointerFunction(Binary);
+  RegisterLoadCheckPointerFunction(AsyncBinary);
   RegisterLoadCheckPointerFunction(Nersc);
 #ifdef HAVE_LIME
   RegisterLoadCheckPointerFunction(ILDG);
@@ -0,0 +1,247 @@
+/*************************************************************************************
+
+Grid physics library, www.github.com/paboyle/Grid
+
+Source file: ./lib/qcd/hmc/AsyncBinaryCheckpointer.h
+
+Copyright (C) 2016
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+See the full license in the file "LICENSE" in the top level distribution
+directory
+*************************************************************************************/
+			   /*  END LEGAL */
+#ifndef ASYNC_BINARY_CHECKPOINTER
+#define ASYNC_BINARY_CHECKPOINTER
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+NAMESPACE_BEGIN(Grid);
+
+/////////////////////////////////////////////////////////////////////////////
+// Binary checkpointer with the file writes taken off the critical path.
+//
+// At the end of a saving trajectory the gauge field(s) and RNG state are
+// unvectorised, munged, checksummed and byte swapped into host staging
+// buffers; this is the only collective part. A helper thread then writes
+// the buffers with plain pwrite while the next trajectory integrates.
+// Files are identical to BinaryHmcCheckpointer and read back by it.
+//
+// MPI is not called from the helper thread (Grid initialises MPI
+// SERIALIZED). A new save, a restore and the end of the run wait for the
+// previous save. The read back and retry of writeLatticeObject is not done.
+/////////////////////////////////////////////////////////////////////////////
+template <class Impl>
+class AsyncBinaryHmcCheckpointer : public BaseHmcCheckpointer<Impl> {
+private:
+  CheckpointerParameters Params;
+
+public:
+  INHERIT_FIELD_TYPES(Impl);  // Gets the Field type, a Lattice object
+
+  // Extract types from the Field
+  typedef typename Field::vector_object vobj;
+  typedef typename vobj::scalar_object sobj;
+  typedef typename getPrecision<sobj>::real_scalar_type sobj_stype;
+  typedef typename sobj::DoublePrecision sobj_double;
+
+  typedef typename GridSerialRNG::RngStateType RngStateType;
+  typedef std::array<RngStateType,GridSerialRNG::RngStateCount> RNGstate;
+
+private:
+  GridBase *grid = nullptr;
+  std::thread writer;
+  bool pending = false;
+  bool writeOK = true;
+  GridStopWatch StageTimer;
+  GridStopWatch OverlapTimer;
+
+  // Staged file images, owned by the writer thread while a save is pending
+  std::string config, rng, smr;
+  std::vector<sobj_double> config_io, smr_io;
+  std::vector<RNGstate>    rng_io, srng_io;
+
+public:
+  AsyncBinaryHmcCheckpointer(const CheckpointerParameters &Params_) {
+    initialize(Params_);
+  }
+
+  ~AsyncBinaryHmcCheckpointer() {
+    if (writer.joinable()) writer.join();
+  }
+
+  void initialize(const CheckpointerParameters &Params_) { Params = Params_; }
+
+  void truncate(std::string file) {
+    std::ofstream fout(file, std::ios::out);
+    fout.close();
+  }
+
+  void StageLattice(Field &U, std::vector<sobj_double> &iodata, uint32_t *csum)
+  {
+    uint64_t lsites = grid->lSites();
+    std::vector<sobj> scalardata(lsites);
+    BinarySimpleUnmunger<sobj_double, sobj> munge;
+    unvectorizeToLexOrdArray(scalardata,U);
+    iodata.resize(lsites);
+    thread_for(x, lsites, { munge(scalardata[x],iodata[x]); });
+    BinaryIO::IOobjectEncode(grid,iodata,Params.format,csum[0],csum[1],csum[2]);
+  }
+
+  void StageRNG(GridSerialRNG &sRNG, GridParallelRNG &pRNG, uint32_t *csum)
+  {
+    const int RngStateCount = GridSerialRNG::RngStateCount;
+    uint64_t lsites = grid->lSites();
+    rng_io.resize(lsites);
+    thread_for(lidx,lsites,{
+      std::vector<RngStateType> tmp(RngStateCount);
+      Coordinate lcoor;
+      grid->LocalIndexToLocalCoor(lidx, lcoor);
+      int o_idx=grid->oIndex(lcoor);
+      int i_idx=grid->iIndex(lcoor);
+      int gidx=pRNG.generator_idx(o_idx,i_idx);
+      pRNG.GetState(tmp,gidx);
+      std::copy(tmp.begin(),tmp.end(),rng_io[lidx].begin());
+    });
+    srng_io.resize(1);
+    {
+      std::vector<RngStateType> tmp(RngStateCount);
+      sRNG.GetState(tmp,0);
+      std::copy(tmp.begin(),tmp.end(),srng_io[0].begin());
+    }
+    uint32_t scsum[3];
+    BinaryIO::IOobjectEncode(grid,rng_io, std::string("IEEE32BIG"),csum[0],csum[1],csum[2]);
+    BinaryIO::IOobjectEncode(grid,srng_io,std::string("IEEE32BIG"),scsum[0],scsum[1],scsum[2]);
+    csum[0] = csum[0] + scsum[0];
+    csum[1] = csum[1] ^ scsum[1];
+    csum[2] = csum[2] ^ scsum[2];
+  }
+
+  void WriteStaged(void)
+  {
+    bool ok = true;
+    uint64_t gsites = grid->gSites();
+    ok = ok && BinaryIO::IOobjectWriteLocal(grid,rng_io,rng,0);
+    ok = ok && BinaryIO::IOobjectWriteLocal(grid,srng_io,rng,gsites*sizeof(RNGstate));
+    ok = ok && BinaryIO::IOobjectWriteLocal(grid,config_io,config,0);
+    if ( Params.saveSmeared ) {
+      ok = ok && BinaryIO::IOobjectWriteLocal(grid,smr_io,smr,0);
+    }
+    writeOK = ok;
+  }
+
+  // Collective: every rank must call this at the same point
+  void WaitForCompletion(void)
+  {
+    if ( !pending ) return;
+    GridStopWatch WaitTimer;
+    WaitTimer.Start();
+    writer.join();
+    grid->Barrier();
+    WaitTimer.Stop();
+    OverlapTimer.Stop();
+    pending = false;
+    if ( !writeOK ) {
+      std::cout << GridLogError << "AsyncBinary checkpoint write failed for " << config << std::endl;
+      assert(0);
+    }
+    std::cout << GridLogMessage << "Written Binary Configuration " << config
+	      << " in background; staging " << StageTimer.Elapsed()
+	      << " overlapped " << OverlapTimer.Elapsed()
+	      << " wait " << WaitTimer.Elapsed() << std::endl;
+  }
+
+  void TrajectoryComplete(int traj,
+			  ConfigurationBase<Field> &SmartConfig,
+			  GridSerialRNG &sRNG, GridParallelRNG &pRNG)
+  {
+    if ((traj % Params.saveInterval) == 0) {
+
+      // The previous save owns the staging buffers until it completes
+      WaitForCompletion();
+
+      grid = SmartConfig.get_U(false).Grid();
+      this->build_filenames(traj, Params, config, smr, rng);
+
+      uint32_t csum[3];
+      StageTimer.Reset();
+      StageTimer.Start();
+
+      StageRNG(sRNG, pRNG, csum);
+      std::cout << GridLogMessage << "Staged Binary RNG " << rng
+                << " checksum " << std::hex
+		<< csum[0] <<"/"<< csum[1] <<"/"<< csum[2]
+		<< std::dec << std::endl;
+
+      StageLattice(SmartConfig.get_U(false), config_io, csum);
+      std::cout << GridLogMessage << "Staged Binary Configuration " << config
+                << " checksum " << std::hex
+		<< csum[0] <<"/"<< csum[1] <<"/"<< csum[2]
+		<< std::dec << std::endl;
+
+      if ( Params.saveSmeared ) {
+	StageLattice(SmartConfig.get_U(true), smr_io, csum);
+	std::cout << GridLogMessage << "Staged Binary Smeared Configuration " << smr
+		  << " checksum " << std::hex
+		  << csum[0] <<"/"<< csum[1] <<"/"<< csum[2]
+		  << std::dec << std::endl;
+      }
+
+      // Create empty files before any rank writes into them
+      if ( grid->IsBoss() ) {
+	truncate(rng);
+	truncate(config);
+	if ( Params.saveSmeared ) truncate(smr);
+      }
+      grid->Barrier();
+      StageTimer.Stop();
+
+      OverlapTimer.Reset();
+      OverlapTimer.Start();
+      pending = true;
+      writer = std::thread([this]{ this->WriteStaged(); });
+    }
+  };
+
+  void CheckpointRestore(int traj, Field &U, GridSerialRNG &sRNG, GridParallelRNG &pRNG) {
+    WaitForCompletion();
+
+    std::string config, rng, smr;
+    this->build_filenames(traj, Params, config, smr, rng);
+    this->check_filename(rng);
+    this->check_filename(config);
+
+    BinarySimpleMunger<sobj_double, sobj> munge;
+
+    uint32_t nersc_csum;
+    uint32_t scidac_csuma;
+    uint32_t scidac_csumb;
+    BinaryIO::readRNG(sRNG, pRNG, rng, 0,nersc_csum,scidac_csuma,scidac_csumb);
+    BinaryIO::readLatticeObject<vobj, sobj_double>(U, config, munge, 0, Params.format,
+						   nersc_csum,scidac_csuma,scidac_csumb);
+
+    std::cout << GridLogMessage << "Read Binary Configuration " << config
+              << " checksums " << std::hex << nersc_csum<<"/"<<scidac_csuma<<"/"<<scidac_csumb
+	      << std::dec << std::endl;
+  };
+};
+
+NAMESPACE_END(Grid);
+
+#endif
@@ -104,6 +104,9 @@ public:
                                  GridSerialRNG &sRNG,
                                  GridParallelRNG &pRNG) = 0;
 
+  // Block until any save still in flight is on disk; collective
+  virtual void WaitForCompletion(void) {};
+
 };  // class BaseHmcCheckpointer
 ///////////////////////////////////////////////////////////////////////////////
 
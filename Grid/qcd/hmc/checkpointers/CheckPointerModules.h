@@ -100,6 +100,19 @@ class BinaryCPModule: public CheckPointerModule< ImplementationPolicy> {
 };
 
 
+template<class ImplementationPolicy>
+class AsyncBinaryCPModule: public CheckPointerModule< ImplementationPolicy> {
+  typedef CheckPointerModule< ImplementationPolicy> CPBase;
+  using CPBase::CPBase; // for constructors
+
+  // acquire resource
+  virtual void initialize(){
+    this->CheckPointPtr.reset(new AsyncBinaryHmcCheckpointer<ImplementationPolicy>(this->Par_));
+  }
+
+};
+
+
 template<class ImplementationPolicy>
 class NerscCPModule: public CheckPointerModule< ImplementationPolicy> {
   typedef CheckPointerModule< ImplementationPolicy> CPBase;
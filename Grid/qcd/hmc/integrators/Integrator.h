@@ -88,6 +88,11 @@ public:
   const ActionSet<Field, RepresentationPolicy> as;
 
   ActionSet<Field,RepresentationPolicy> LevelForces;
+
+  // Force statistics are gathered on every ForceDiagnostics-th update_P of
+  // a level (default every one); zero turns them off
+  int ForceDiagnostics;
+  std::vector<int> update_P_count;
   
   //Get a pointer to a shared static instance of the "do-nothing" momentum filter to serve as a default
   static MomentumFilterBase<MomentaField> const* getDefaultMomFilter(){ 
@@ -122,14 +127,99 @@ public:
   } update_P_hireps{};
 
  
+  // Per-site norm2 of a force, one real per site
+  typedef Lattice<typename Field::vector_object::tensor_reduced> ForceNormField;
+
+  // Mom -= coeff*force in the same pass as the per-site force norms and,
+  // when tracking the level total, level_force += force (and its norms).
+  // level_force and lnrm are only touched, and need only exist, when track_level is set.
+  static void update_P_fused(MomentaField &Mom, const Field &force, RealD coeff,
+			     ForceNormField &nrm, Field *level_force, ForceNormField *lnrm,
+			     bool track_level, bool level_norms)
+  {
+    GridBase *grid = Mom.Grid();
+    autoView( Mom_v  , Mom        , AcceleratorWrite);
+    autoView( F_v    , force      , AcceleratorRead);
+    autoView( nrm_v  , nrm        , AcceleratorWrite);
+    if ( !track_level ) {
+      accelerator_for(ss, grid->oSites(), Field::vector_type::Nsimd(), {
+	auto f = F_v(ss);
+	coalescedWrite(Mom_v[ss], Mom_v(ss) - f*coeff);
+	coalescedWrite(nrm_v[ss], innerProduct(f,f));
+      });
+      return;
+    }
+    assert(level_force != nullptr && lnrm != nullptr);
+    autoView( L_v    , (*level_force), AcceleratorWrite);
+    autoView( lnrm_v , (*lnrm)       , AcceleratorWrite);
+    accelerator_for(ss, grid->oSites(), Field::vector_type::Nsimd(), {
+      auto f = F_v(ss);
+      coalescedWrite(Mom_v[ss], Mom_v(ss) - f*coeff);
+      coalescedWrite(nrm_v[ss], innerProduct(f,f));
+      auto l = L_v(ss) + f;
+      coalescedWrite(L_v[ss], l);
+      if ( level_norms ) coalescedWrite(lnrm_v[ss], innerProduct(l,l));
+    });
+  }
+
+  // Node local sum and maximum over sites of a norm field
+  static void local_sum_max(const ForceNormField &nrm, RealD &sum, RealD &max)
+  {
+    typedef typename ForceNormField::vector_object vscalar;
+    const int Nsimd = vscalar::Nsimd();
+    autoView( nrm_v, nrm, CpuRead);
+    sum = 0.0;
+    max = 0.0;
+    thread_region
+    {
+      RealD sum_thr = 0.0;
+      RealD max_thr = 0.0;
+      thread_for_in_region(ss, nrm.Grid()->oSites(), {
+	for(int lane=0;lane<Nsimd;lane++){
+	  RealD r = real(TensorRemove(extractLane(lane,nrm_v[ss])));
+	  sum_thr += r;
+	  max_thr  = std::max(max_thr,r);
+	}
+      });
+      thread_critical
+      {
+	sum += sum_thr;
+	max  = std::max(max,max_thr);
+      }
+    }
+  }
+
   void update_P(MomentaField& Mom, Field& U, int level, double ep) {
     // input U actually not used in the fundamental case
     // Fundamental updates, include smearing
 
     assert(as.size()==LevelForces.size());
-    
-    Field level_force(U.Grid()); level_force =Zero();
-    for (int a = 0; a < as[level].actions.size(); ++a) {
+
+    int nact = as[level].actions.size();
+    bool diagnostics = (ForceDiagnostics > 0) && ((update_P_count[level]++ % ForceDiagnostics) == 0);
+    RealD coeff = ep * HMC_MOMENTUM_DENOMINATOR;
+
+    // Force statistics of each action then of the level total, reduced together
+    std::vector<RealD> norm_sum(nact+1,0.0);
+    std::vector<RealD> norm_max(nact+1,0.0);
+
+    // A single action is its own level total
+    bool track_level = diagnostics && (nact > 1);
+    // Diagnostic work fields exist only on the steps that report
+    std::unique_ptr<ForceNormField> nrm;
+    std::unique_ptr<ForceNormField> lnrm;
+    std::unique_ptr<Field> level_force;
+    if ( diagnostics ) nrm.reset(new ForceNormField(U.Grid()));
+    if ( track_level ) {
+      lnrm.reset(new ForceNormField(U.Grid()));
+      level_force.reset(new Field(U.Grid()));
+      *level_force = Zero();
+    }
+    if ( diagnostics ) MemoryManager::Print();
+    // The level total has no timer, so count its force evaluations here
+    LevelForces[level].actions.at(0)->deriv_calls++;
+
+    for (int a = 0; a < nact; ++a) {
 
       double start_full = usecond();
       Field force(U.Grid());
@@ -137,11 +227,9 @@ public:
 
       double start_force = usecond();
 
-      MemoryManager::Print();
       as[level].actions.at(a)->deriv_timer_start();
       as[level].actions.at(a)->deriv(Smearer, force);  // deriv should NOT include Ta
       as[level].actions.at(a)->deriv_timer_stop();
-      MemoryManager::Print();
 
       auto name = as[level].actions.at(a)->action_name();
 
@@ -152,24 +240,18 @@ public:
 
       std::cout << GridLogIntegrator << " update_P : Level [" << level <<"]["<<a <<"] "<<name<<" dt "<<ep<<  std::endl;
 
-      // track the total
-      level_force = level_force+force;
-
-      Real force_abs   = std::sqrt(norm2(force)/U.Grid()->gSites()); //average per-site norm.  nb. norm2(latt) = \sum_x norm2(latt[x]) 
-      Real impulse_abs = force_abs * ep * HMC_MOMENTUM_DENOMINATOR;    
-
-      Real force_max   = std::sqrt(maxLocalNorm2(force));
-      Real impulse_max = force_max * ep * HMC_MOMENTUM_DENOMINATOR;    
-
-      as[level].actions.at(a)->deriv_log(force_abs,force_max,impulse_abs,impulse_max);
-      
-      std::cout << GridLogIntegrator<< "["<<level<<"]["<<a<<"] dt           : " << ep <<" "<<name<<std::endl;
-      std::cout << GridLogIntegrator<< "["<<level<<"]["<<a<<"] Force average: " << force_abs <<" "<<name<<std::endl;
-      std::cout << GridLogIntegrator<< "["<<level<<"]["<<a<<"] Force max    : " << force_max <<" "<<name<<std::endl;
-      std::cout << GridLogIntegrator<< "["<<level<<"]["<<a<<"] Fdt average  : " << impulse_abs <<" "<<name<<std::endl;
-      std::cout << GridLogIntegrator<< "["<<level<<"]["<<a<<"] Fdt max      : " << impulse_max <<" "<<name<<std::endl;
+      if ( diagnostics ) {
+	bool last = (a == nact-1);
+	update_P_fused(Mom, force, coeff, *nrm, level_force.get(), lnrm.get(), track_level, last);
+	local_sum_max(*nrm, norm_sum[a], norm_max[a]);
+	if ( last ) {
+	  if ( track_level ) local_sum_max(*lnrm, norm_sum[nact], norm_max[nact]);
+	  else { norm_sum[nact] = norm_sum[a]; norm_max[nact] = norm_max[a]; }
+	}
+      } else {
+	Mom -= force * coeff;
+      }
 
-      Mom -= force * ep* HMC_MOMENTUM_DENOMINATOR;; 
       double end_full = usecond();
       double time_full  = (end_full - start_full) / 1e3;
       double time_force = (end_force - start_force) / 1e3;
@@ -177,14 +259,31 @@ public:
 
     }
 
-    {
-      // total force
-      Real force_abs   = std::sqrt(norm2(level_force)/U.Grid()->gSites()); //average per-site norm.  nb. norm2(latt) = \sum_x norm2(latt[x]) 
-      Real impulse_abs = force_abs * ep * HMC_MOMENTUM_DENOMINATOR;    
-
-      Real force_max   = std::sqrt(maxLocalNorm2(level_force));
-      Real impulse_max = force_max * ep * HMC_MOMENTUM_DENOMINATOR;    
-      LevelForces[level].actions.at(0)->deriv_log(force_abs,force_max,impulse_abs,impulse_max);
+    if ( diagnostics && nact ) {
+      U.Grid()->GlobalSumVector(&norm_sum[0],nact+1);
+      U.Grid()->GlobalMaxVector(&norm_max[0],nact+1);
+
+      for (int a = 0; a <= nact; ++a) {
+	//average per-site norm.  nb. norm2(latt) = \sum_x norm2(latt[x]) 
+	Real force_abs   = std::sqrt(norm_sum[a]/U.Grid()->gSites());
+	Real impulse_abs = force_abs * coeff;
+
+	Real force_max   = std::sqrt(norm_max[a]);
+	Real impulse_max = force_max * coeff;
+
+	if ( a == nact ) {
+	  LevelForces[level].actions.at(0)->deriv_log(force_abs,force_max,impulse_abs,impulse_max);
+	  continue;
+	}
+	as[level].actions.at(a)->deriv_log(force_abs,force_max,impulse_abs,impulse_max);
+
+	auto name = as[level].actions.at(a)->action_name();
+	std::cout << GridLogIntegrator<< "["<<level<<"]["<<a<<"] dt           : " << ep <<" "<<name<<std::endl;
+	std::cout << GridLogIntegrator<< "["<<level<<"]["<<a<<"] Force average: " << force_abs <<" "<<name<<std::endl;
+	std::cout << GridLogIntegrator<< "["<<level<<"]["<<a<<"] Force max    : " << force_max <<" "<<name<<std::endl;
+	std::cout << GridLogIntegrator<< "["<<level<<"]["<<a<<"] Fdt average  : " << impulse_abs <<" "<<name<<std::endl;
+	std::cout << GridLogIntegrator<< "["<<level<<"]["<<a<<"] Fdt max      : " << impulse_max <<" "<<name<<std::endl;
+      }
     }
 
     // Force from the other representations
@@ -232,6 +331,8 @@ public:
   {
     t_P.resize(levels, 0.0);
     t_U = 0.0;
+    ForceDiagnostics = 1;
+    update_P_count.resize(levels, 0);
     // initialization of smearer delegated outside of Integrator
 
     //Default the momentum filter to "do-nothing"
@@ -261,6 +362,11 @@ public:
     MomFilter = &filter;
   }
 
+  //Sample force statistics every 'every' momentum updates of a level, 0 for never
+  void setForceDiagnostics(int every){
+    ForceDiagnostics = std::max(every,0);
+  }
+
   //Access the conjugate momentum
   const MomentaField & getMomentum() const{ return P; }
   
@@ -326,30 +432,62 @@ public:
     std::cout << GridLogMessage << "------------------------- "<<std::endl;
     for (int level = 0; level < as.size(); ++level) {
       for (int actionID = 0; actionID < as[level].actions.size(); ++actionID) {
-	std::cout << GridLogMessage 
-		  << as[level].actions.at(actionID)->action_name()
-		  <<"["<<level<<"]["<< actionID<<"] :\n\t\t "
-		  <<" force max " << as[level].actions.at(actionID)->deriv_max_average()
-		  <<" norm "      << as[level].actions.at(actionID)->deriv_norm_average()
-		  <<" Fdt max  "  << as[level].actions.at(actionID)->Fdt_max_average()
-		  <<" Fdt norm "  << as[level].actions.at(actionID)->Fdt_norm_average()
-		  <<" calls "     << as[level].actions.at(actionID)->deriv_num
-		  << std::endl;
+	print_force_average(as[level].actions.at(actionID),level,actionID);
       }
       int actionID=0;
-      std::cout << GridLogMessage 
-		  << LevelForces[level].actions.at(actionID)->action_name()
-		  <<"["<<level<<"]["<< actionID<<"] :\n\t\t "
-		  <<" force max " << LevelForces[level].actions.at(actionID)->deriv_max_average()
-		  <<" norm "      << LevelForces[level].actions.at(actionID)->deriv_norm_average()
-		  <<" Fdt max  "  << LevelForces[level].actions.at(actionID)->Fdt_max_average()
-		  <<" Fdt norm "  << LevelForces[level].actions.at(actionID)->Fdt_norm_average()
-		  <<" calls "     << LevelForces[level].actions.at(actionID)->deriv_num
-		  << std::endl;
+      print_force_average(LevelForces[level].actions.at(actionID),level,actionID);
     }
     std::cout << GridLogMessage << ":::::::::::::::::::::::::::::::::::::::::"<< std::endl;
   }
-  
+
+  template<class ActionPtr>
+  void print_force_average(ActionPtr action,int level,int actionID)
+  {
+    std::cout << GridLogMessage 
+	      << action->action_name()
+	      <<"["<<level<<"]["<< actionID<<"] :\n\t\t ";
+    if ( action->deriv_num ) {
+      std::cout <<" force max " << action->deriv_max_average()
+		<<" norm "      << action->deriv_norm_average()
+		<<" Fdt max  "  << action->Fdt_max_average()
+		<<" Fdt norm "  << action->Fdt_norm_average();
+    }
+    std::cout <<" calls "     << action->deriv_calls
+	      <<" samples "   << action->deriv_num
+	      << std::endl;
+  }
+
+  // The print_timer data as one JSON array of per-action records
+  json json_timer(void)
+  {
+    json actions = json::array();
+    for (int level = 0; level < as.size(); ++level) {
+      for (int actionID = 0; actionID < as[level].actions.size(); ++actionID) {
+	auto action = as[level].actions.at(actionID);
+	json a;
+	a["name"]          = action->action_name();
+	a["level"]         = level;
+	a["id"]            = actionID;
+	a["refresh_s"]     = action->refresh_us*1.0e-6;
+	a["S_s"]           = action->S_us*1.0e-6;
+	a["force_s"]       = action->deriv_us*1.0e-6;
+	a["force_calls"]   = action->deriv_calls;
+	a["force_samples"] = action->deriv_num;
+	a["refresh_iter"]  = action->refresh_iter;
+	a["S_iter"]        = action->S_iter;
+	a["force_iter"]    = action->deriv_iter;
+	if ( action->deriv_num ) {
+	  a["force_max"]     = action->deriv_max_average();
+	  a["force_norm"]    = action->deriv_norm_average();
+	  a["Fdt_max"]       = action->Fdt_max_average();
+	  a["Fdt_norm"]      = action->Fdt_norm_average();
+	}
+	actions.push_back(a);
+      }
+    }
+    return actions;
+  }
+
   void print_parameters()
   {
     std::cout << GridLogMessage << "[Integrator] Name : "<< integrator_name() << std::endl;
@@ -275,6 +275,209 @@ public:
   }
 };
 
+/////////////////////////////////////////////////////////////////////////////
+// Symmetric splittings of arbitrary length, nested over the levels.
+//
+// A scheme lists the stages of one step of size h at a level: P stages
+// kick the momentum with the forces of that level for c*h, U stages evolve
+// the next level (the links at the finest level) for c*h. A P stage with a
+// force gradient coefficient xi is applied through the Hessian free shift
+// of ForceGradient, adding xi*h^3 times the gradient of |F|^2.
+//
+// The closing P stage of a step is carried over and merged into the opening
+// P stage of the next step at the same level. The two steps may differ in
+// length when the U stages above them are unequal, so the carried kick is
+// kept per level rather than doubled.
+/////////////////////////////////////////////////////////////////////////////
+struct IntegratorStage {
+  enum { P = 0, U = 1 };
+  int   type;
+  RealD c;
+  RealD xi;
+};
+
+template <class FieldImplementation_, class SmearingPolicy, class RepresentationPolicy = Representations<FundamentalRepresentation> >
+class SplittingIntegrator : public Integrator<FieldImplementation_, SmearingPolicy, RepresentationPolicy>
+{
+public:
+  typedef FieldImplementation_ FieldImplementation;
+  INHERIT_FIELD_TYPES(FieldImplementation);
+
+  SplittingIntegrator(GridBase* grid, IntegratorParameters Par,
+		      ActionSet<Field, RepresentationPolicy>& Aset,
+		      SmearingPolicy& Sm)
+    : Integrator<FieldImplementation, SmearingPolicy, RepresentationPolicy>(grid, Par, Aset, Sm),
+      carry(Aset.size(), 0.0) {};
+
+  // Stages of one step at this level; must start or end with the same type
+  virtual std::vector<IntegratorStage> scheme(int level) = 0;
+
+  void step(Field& U, int level, int _first, int _last) {
+    assert(level == 0);
+    if (_first) std::fill(carry.begin(), carry.end(), 0.0);
+    evolve(U, 0, this->Params.trajL / this->Params.MDsteps, _last);
+  }
+
+protected:
+  std::vector<RealD> carry;  // deferred closing P kick per level
+
+  void FG_update_P(Field& U, int level, double fg_dt, double ep) {
+    Field Ufg(U.Grid());
+    Field Pfg(U.Grid());
+    Ufg = U;
+    Pfg = Zero();
+    std::cout << GridLogIntegrator << "FG update " << fg_dt << " " << ep << std::endl;
+    this->update_P(Pfg, Ufg, level, fg_dt);
+    Pfg = Pfg*(1.0/fg_dt);
+    this->update_U(Pfg, Ufg, fg_dt);
+    this->update_P(Ufg, level, ep);
+    // update_U pointed the smearer and representations at Ufg
+    this->Smearer.set_Field(U);
+    this->Representations.update(U);
+  }
+
+  void kick(Field& U, int level, RealD ep) {
+    if (ep != 0.0) this->update_P(U, level, ep);
+  }
+
+  // Integrate level "level" over time tau in multiplier steps
+  void evolve(Field& U, int level, RealD tau, int _last) {
+    int fl = this->as.size() - 1;
+    int multiplier = this->as[level].multiplier;
+    RealD h = tau / multiplier;
+    std::vector<IntegratorStage> stages = scheme(level);
+    int ns = stages.size();
+    int last_U = ns - 1;
+    while (stages[last_U].type != IntegratorStage::U) last_U--;
+
+    for (int e = 0; e < multiplier; ++e) {
+      int last_step = _last && (e == multiplier - 1);
+
+      for (int s = 0; s < ns; ++s) {
+	const IntegratorStage &st = stages[s];
+	if (st.type == IntegratorStage::P) {
+	  RealD ep = st.c * h;
+	  if ( (s == ns - 1) && !last_step ) {
+	    carry[level] += ep;
+	  } else if ( st.xi != 0.0 ) {
+	    kick(U, level, carry[level]);
+	    carry[level] = 0.0;
+	    FG_update_P(U, level, 2.0 * st.xi * h * h * h / ep, ep);
+	  } else {
+	    kick(U, level, ep + carry[level]);
+	    carry[level] = 0.0;
+	  }
+	} else {
+	  kick(U, level, carry[level]);
+	  carry[level] = 0.0;
+	  int last_inner = last_step && (s == last_U);
+	  if (level == fl) {
+	    this->update_U(U, st.c * h);
+	  } else {
+	    evolve(U, level + 1, st.c * h, last_inner);
+	  }
+	}
+      }
+    }
+  }
+};
+
+// Omelyan, Mryglod and Folk, Comput. Phys. Commun. 151 (2003) 272.
+// Fourth order minimum norm, velocity version, five force evaluations per
+// step: PUPUPUPUPUP
+template <class FieldImplementation_, class SmearingPolicy, class RepresentationPolicy = Representations<FundamentalRepresentation> >
+class MinimumNorm4FV : public SplittingIntegrator<FieldImplementation_, SmearingPolicy, RepresentationPolicy>
+{
+private:
+  const RealD theta  =  0.08398315262876693;
+  const RealD rho    =  0.2539785108410595;
+  const RealD lambda =  0.6822365335719091;
+  const RealD mu     = -0.03230286765269967;
+
+public:
+  typedef FieldImplementation_ FieldImplementation;
+  INHERIT_FIELD_TYPES(FieldImplementation);
+
+  MinimumNorm4FV(GridBase* grid, IntegratorParameters Par, ActionSet<Field, RepresentationPolicy>& Aset, SmearingPolicy& Sm)
+    : SplittingIntegrator<FieldImplementation, SmearingPolicy, RepresentationPolicy>(grid, Par, Aset, Sm){};
+
+  std::string integrator_name(){return "MinimumNorm4FV";}
+
+  std::vector<IntegratorStage> scheme(int level) {
+    const int P = IntegratorStage::P;
+    const int U = IntegratorStage::U;
+    RealD p3 = 0.5 - lambda - theta;
+    RealD u3 = 1.0 - 2.0 * (mu + rho);
+    return { {P, theta, 0}, {U, rho, 0}, {P, lambda, 0}, {U, mu, 0}, {P, p3, 0}, {U, u3, 0},
+	     {P, p3, 0}, {U, mu, 0}, {P, lambda, 0}, {U, rho, 0}, {P, theta, 0} };
+  }
+};
+
+// Omelyan, Mryglod and Folk: fourth order minimum norm, position version,
+// four force evaluations per step: UPUPUPUPU
+template <class FieldImplementation_, class SmearingPolicy, class RepresentationPolicy = Representations<FundamentalRepresentation> >
+class MinimumNorm4FP : public SplittingIntegrator<FieldImplementation_, SmearingPolicy, RepresentationPolicy>
+{
+private:
+  const RealD rho    =  0.1786178958448091;
+  const RealD theta  = -0.06626458266981843;
+  const RealD lambda =  0.7123418310626056;
+
+public:
+  typedef FieldImplementation_ FieldImplementation;
+  INHERIT_FIELD_TYPES(FieldImplementation);
+
+  MinimumNorm4FP(GridBase* grid, IntegratorParameters Par, ActionSet<Field, RepresentationPolicy>& Aset, SmearingPolicy& Sm)
+    : SplittingIntegrator<FieldImplementation, SmearingPolicy, RepresentationPolicy>(grid, Par, Aset, Sm){};
+
+  std::string integrator_name(){return "MinimumNorm4FP";}
+
+  std::vector<IntegratorStage> scheme(int level) {
+    const int P = IntegratorStage::P;
+    const int U = IntegratorStage::U;
+    RealD u3 = 1.0 - 2.0 * (theta + rho);
+    return { {U, rho, 0}, {P, lambda, 0}, {U, theta, 0}, {P, 0.5 - lambda, 0}, {U, u3, 0},
+	     {P, 0.5 - lambda, 0}, {U, theta, 0}, {P, lambda, 0}, {U, rho, 0} };
+  }
+};
+
+// Force gradient (PUP'UP, lambda=1/6, xi=1/72) on the selected levels and
+// the second order minimum norm scheme on the others. By default only the
+// outermost level, which carries the expensive fermion forces and the
+// largest step, pays for the gradient shift.
+template <class FieldImplementation_, class SmearingPolicy, class RepresentationPolicy = Representations<FundamentalRepresentation> >
+class ForceGradientMultiLevel : public SplittingIntegrator<FieldImplementation_, SmearingPolicy, RepresentationPolicy>
+{
+private:
+  const RealD lambda_fg = 1.0 / 6.0;
+  const RealD xi_fg     = 1.0 / 72.0;
+  const RealD lambda_mn = 0.1931833275037836;
+
+public:
+  typedef FieldImplementation_ FieldImplementation;
+  INHERIT_FIELD_TYPES(FieldImplementation);
+
+  std::vector<int> ForceGradientLevels;
+
+  ForceGradientMultiLevel(GridBase* grid, IntegratorParameters Par, ActionSet<Field, RepresentationPolicy>& Aset, SmearingPolicy& Sm)
+    : SplittingIntegrator<FieldImplementation, SmearingPolicy, RepresentationPolicy>(grid, Par, Aset, Sm),
+      ForceGradientLevels({0}) {};
+
+  std::string integrator_name(){return "ForceGradientMultiLevel";}
+
+  void setForceGradientLevels(const std::vector<int> &levels) { ForceGradientLevels = levels; }
+
+  std::vector<IntegratorStage> scheme(int level) {
+    const int P = IntegratorStage::P;
+    const int U = IntegratorStage::U;
+    bool fg = std::find(ForceGradientLevels.begin(), ForceGradientLevels.end(), level) != ForceGradientLevels.end();
+    if ( fg ) {
+      return { {P, lambda_fg, 0}, {U, 0.5, 0}, {P, 1.0 - 2.0 * lambda_fg, xi_fg}, {U, 0.5, 0}, {P, lambda_fg, 0} };
+    }
+    return { {P, lambda_mn, 0}, {U, 0.5, 0}, {P, 1.0 - 2.0 * lambda_mn, 0}, {U, 0.5, 0}, {P, lambda_mn, 0} };
+  }
+};
+
 NAMESPACE_END(Grid);
 
 #endif  // INTEGRATOR_INCLUDED
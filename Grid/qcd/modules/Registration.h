@@ -124,6 +124,9 @@ static Registrar<ILDGCPModule<ImplementationPolicy>  , HMC_CPModuleFactory<cp_st
 static Registrar< HMCLeapFrog<ImplementationPolicy, RepresentationPolicy, Serialiser>      , HMCRunnerModuleFactory<hmc_string, Serialiser> > __HMCLFmodXMLInit("LeapFrog");
 static Registrar< HMCMinimumNorm2<ImplementationPolicy, RepresentationPolicy, Serialiser>  , HMCRunnerModuleFactory<hmc_string, Serialiser> > __HMCMN2modXMLInit("MinimumNorm2");
 static Registrar< HMCForceGradient<ImplementationPolicy, RepresentationPolicy, Serialiser> , HMCRunnerModuleFactory<hmc_string, Serialiser> > __HMCFGmodXMLInit("ForceGradient");
+static Registrar< HMCMinimumNorm4FV<ImplementationPolicy, RepresentationPolicy, Serialiser> , HMCRunnerModuleFactory<hmc_string, Serialiser> > __HMCMN4FVmodXMLInit("MinimumNorm4FV");
+static Registrar< HMCMinimumNorm4FP<ImplementationPolicy, RepresentationPolicy, Serialiser> , HMCRunnerModuleFactory<hmc_string, Serialiser> > __HMCMN4FPmodXMLInit("MinimumNorm4FP");
+static Registrar< HMCForceGradientMultiLevel<ImplementationPolicy, RepresentationPolicy, Serialiser> , HMCRunnerModuleFactory<hmc_string, Serialiser> > __HMCFGMLmodXMLInit("ForceGradientMultiLevel");
 
 typedef HMCRunnerModuleFactory<hmc_string, Serialiser > HMCModuleFactory;
 
@@ -32,13 +32,62 @@ public:
 
   LatticeField U;
 
-  explicit TwoIndexRep(GridBase *grid) : U(grid) {}
+  typedef typename GaugeGroupTwoIndex<ncolour, S, group_name>::BaseEntry BaseEntry;
+  static const int MaxBaseEntries = GaugeGroupTwoIndex<ncolour, S, group_name>::MaxBaseEntries;
+
+  explicit TwoIndexRep(GridBase *grid) : U(grid) {
+    // sparse table of the base e^(ij), shared by the site kernel
+    base_nnz.resize(Dimension);
+    base_entries.resize(Dimension * MaxBaseEntries);
+    for (int a = 0; a < Dimension; a++)
+      base_nnz[a] = GaugeGroupTwoIndex<ncolour, S, group_name>::baseSparse(a, &base_entries[a * MaxBaseEntries]);
+  }
 
   void update_representation(const LatticeGaugeField &Uin) {
     std::cout << GridLogDebug << "Updating TwoIndex representation\n";
     // Uin is in the fundamental representation
     // get the U in TwoIndexRep
     // (U)_{(ij)(lk)} = tr [ adj(e^(ij)) U e^(lk) transpose(U) ]
+    //
+    // The e^(ij) are real and sparse, so with e^a_{kj} and e^b_{li} the
+    // only non-zero entries the trace reduces to
+    //   sum e^a_{kj} e^b_{li} U_{ji} U_{kl}
+    // which is evaluated site by site in a single sweep
+    conformable(U, Uin);
+    GridBase *grid = Uin.Grid();
+
+    autoView(Uin_v, Uin, AcceleratorRead);
+    autoView(U_v, U, AcceleratorWrite);
+    auto nnz_p = &base_nnz[0];
+    auto ent_p = &base_entries[0];
+
+    accelerator_for(ss, grid->oSites(), grid->Nsimd(), {
+      typedef decltype(coalescedRead(U_v[0](0))) TwoIndexSite;
+      for (int mu = 0; mu < Nd; mu++) {
+        auto Umu = coalescedRead(Uin_v[ss](mu));
+        TwoIndexSite Umu_R;
+        for (int a = 0; a < Dimension; a++) {
+          for (int b = 0; b < Dimension; b++) {
+            auto tr = Umu()(0, 0);
+            tr = Zero();
+            for (int p = 0; p < nnz_p[a]; p++) {
+              const BaseEntry &ea = ent_p[a * MaxBaseEntries + p];
+              for (int q = 0; q < nnz_p[b]; q++) {
+                const BaseEntry &eb = ent_p[b * MaxBaseEntries + q];
+                tr = tr + Umu()(ea.col, eb.col) * Umu()(ea.row, eb.row) * (ea.val * eb.val);
+              }
+            }
+            Umu_R()(a, b) = tr;
+          }
+        }
+        coalescedWrite(U_v[ss](mu), Umu_R);
+      }
+    });
+  }
+
+  // Reference implementation of update_representation, built from lattice
+  // wide expressions; kept for testing and benchmarking the site kernel
+  void update_representation_reference(const LatticeGaugeField &Uin) {
     conformable(U, Uin);
     U = Zero();
     LatticeColourMatrix tmp(Uin.Grid());
@@ -80,6 +129,9 @@ public:
   }
 
 private:
+  Vector<int> base_nnz;
+  Vector<BaseEntry> base_entries;
+
   void projectOnAlgebra(typename GaugeGroup<ncolour, group_name>::LatticeAlgebraVector &h_out,
                         const LatticeMatrix &in, Real scale = 1.0) const {
     GaugeGroupTwoIndex<ncolour, S,group_name>::projectOnAlgebra(h_out, in, scale);
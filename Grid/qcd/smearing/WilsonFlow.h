@@ -32,6 +32,11 @@ directory
 
 NAMESPACE_BEGIN(Grid);
 
+//Action whose gradient drives the flow. Symanzik is the tree-level Luscher-Weisz
+//action (c1 = -1/12); Zeuthen is the Symanzik force with the O(a^2) correction
+//(1 + a^2/12 D*_mu D_mu) of Ramos and Sint, arXiv:1508.05552
+enum class FlowAction { Wilson, Symanzik, Zeuthen };
+
 template <class Gimpl>
 class WilsonFlowBase: public Smear<Gimpl>{
 public:
@@ -42,18 +47,32 @@ protected:
   std::vector< std::pair<int, FunctionType> > functions; //The int maps to the measurement frequency
 
   mutable WilsonGaugeAction<Gimpl> SG;
+  mutable SymanzikGaugeAction<Gimpl> SS;
+  FlowAction action;
    
 public:
   INHERIT_GIMPL_TYPES(Gimpl)
 
-  explicit WilsonFlowBase(unsigned int meas_interval =1):
-    SG(WilsonGaugeAction<Gimpl>(3.0)) {
-    // WilsonGaugeAction with beta 3.0
+  explicit WilsonFlowBase(unsigned int meas_interval =1, FlowAction action = FlowAction::Wilson):
+    SG(WilsonGaugeAction<Gimpl>(3.0)), SS(3.0), action(action) {
+    // WilsonGaugeAction and SymanzikGaugeAction with beta 3.0
     setDefaultMeasurements(meas_interval);
   }
     
   void resetActions(){ functions.clear(); }
 
+  void setFlowAction(FlowAction a){ action = a; }
+  FlowAction getFlowAction() const{ return action; }
+
+  //The flow force Z(U) for the chosen action; the flow is dU/dt = -2 Z(U) U
+  void flowForce(GaugeField &Z, const GaugeField &U) const;
+
+  //Apply (1 + 1/12 D*_mu D_mu) to each component of Z, D_mu covariant in the links U
+  static void zeuthenCorrection(GaugeField &Z, const GaugeField &U);
+
+  //Ramos' distance between two fields, arXiv:1301.4388: max over sites and mu of |U-V|/Nc^2
+  static RealD flowDistance(const GaugeField &U, const GaugeField &V);
+
   void addMeasurement(int meas_interval, FunctionType meas){ functions.push_back({meas_interval, meas}); }
 
   //Set the class to perform the default measurements: 
@@ -73,6 +92,17 @@ public:
   //Compute t^2 <E(t)> for time t from the 1x1 cloverleaf form
   //t is the Wilson flow time
   static RealD energyDensityCloverleaf(const RealD t, const GaugeField& U);
+
+  //Compute t^2 E(t) from the plaquette and from the cloverleaf, and the cloverleaf
+  //topological charge, per timeslice and in a single pass over the links.
+  //The energy densities are averaged over each timeslice, the charge is summed
+  static void timesliceFlowObservables(const RealD t, const GaugeField& U,
+				       std::vector<RealD> &Eplaq, std::vector<RealD> &Eclov, std::vector<RealD> &Q,
+				       typename WilsonLoops<Gimpl>::CloverObservablesWorkspace &wk);
+
+  //As above, for the whole volume
+  static void flowObservables(const RealD t, const GaugeField& U, RealD &Eplaq, RealD &Eclov, RealD &Q,
+			      typename WilsonLoops<Gimpl>::CloverObservablesWorkspace &wk);
   
   //Evolve the gauge field by Nstep steps of epsilon and return the energy density computed every interval steps
   //The smeared field is output as V
@@ -104,7 +134,8 @@ public:
   INHERIT_GIMPL_TYPES(Gimpl)
 
   //Integrate the Wilson flow for Nstep steps of size epsilon
-  WilsonFlow(const RealD epsilon, const int Nstep, unsigned int meas_interval = 1): WilsonFlowBase<Gimpl>(meas_interval), Nstep(Nstep), epsilon(epsilon){}
+  WilsonFlow(const RealD epsilon, const int Nstep, unsigned int meas_interval = 1, FlowAction action = FlowAction::Wilson):
+    WilsonFlowBase<Gimpl>(meas_interval,action), Nstep(Nstep), epsilon(epsilon){}
 
   void smear(GaugeField& out, const GaugeField& in) const override;
 };
@@ -129,8 +160,56 @@ private:
 public:
   INHERIT_GIMPL_TYPES(Gimpl)
 
-  WilsonFlowAdaptive(const RealD init_epsilon, const RealD maxTau, const RealD tolerance, unsigned int meas_interval = 1): 
-  WilsonFlowBase<Gimpl>(meas_interval), init_epsilon(init_epsilon), maxTau(maxTau), tolerance(tolerance){}
+  WilsonFlowAdaptive(const RealD init_epsilon, const RealD maxTau, const RealD tolerance, unsigned int meas_interval = 1, FlowAction action = FlowAction::Wilson): 
+  WilsonFlowBase<Gimpl>(meas_interval,action), init_epsilon(init_epsilon), maxTau(maxTau), tolerance(tolerance){}
+
+  void smear(GaugeField& out, const GaugeField& in) const override;
+};
+
+//Fourth order commutator-free Lie group integrator of Celledoni, Marthinsen and Owren,
+//Future Gener. Comput. Syst. 19 (2003) 341. Four force evaluations per step:
+//  Y2 = exp(h/2 F1) U,  Y3 = exp(h/2 F2) U,  Y4 = exp(h F3 - h/2 F1) Y2
+//  U' = exp(h/12 (-F1+2F2+2F3+3F4)) exp(h/12 (3F1+2F2+2F3-F4)) U
+template <class Gimpl>
+class WilsonFlowCF4: public WilsonFlowBase<Gimpl>{
+private:
+  int Nstep; //number of steps
+  RealD epsilon;  //step size
+
+  //Evolve the gauge field by 1 step of size eps and update tau
+  void evolve_step(typename Gimpl::GaugeField &U, RealD &tau) const;
+
+public:
+  INHERIT_GIMPL_TYPES(Gimpl)
+
+  WilsonFlowCF4(const RealD epsilon, const int Nstep, unsigned int meas_interval = 1, FlowAction action = FlowAction::Wilson):
+    WilsonFlowBase<Gimpl>(meas_interval,action), Nstep(Nstep), epsilon(epsilon){}
+
+  void smear(GaugeField& out, const GaugeField& in) const override;
+};
+
+//Adaptive CF4. The error estimate is the distance to an embedded third order solution
+//built from the same stages and the force F5 at the new field,
+//  U'' = exp(h/12 (-F1+2F2+2F3+3F5)) exp(h/12 (3F1+2F2+2F3-F5)) U
+//which satisfies the classical third order conditions and the commutator condition.
+//F5 is the F1 of the next step, so an accepted step costs four force evaluations,
+//and the step size follows the fourth power of the local error.
+template <class Gimpl>
+class WilsonFlowCF4Adaptive: public WilsonFlowBase<Gimpl>{
+private:
+  RealD init_epsilon; //initial step size
+  RealD maxTau; //integrate to t=maxTau
+  RealD tolerance; //integration error tolerance
+
+  //As WilsonFlowAdaptive::evolve_step_adaptive. F1 is the force at U on entry and is
+  //replaced by the force at the new field on success
+  int evolve_step_adaptive(typename Gimpl::GaugeField &U, typename Gimpl::GaugeField &F1, RealD &tau, RealD &eps) const;
+
+public:
+  INHERIT_GIMPL_TYPES(Gimpl)
+
+  WilsonFlowCF4Adaptive(const RealD init_epsilon, const RealD maxTau, const RealD tolerance, unsigned int meas_interval = 1, FlowAction action = FlowAction::Wilson):
+  WilsonFlowBase<Gimpl>(meas_interval,action), init_epsilon(init_epsilon), maxTau(maxTau), tolerance(tolerance){}
 
   void smear(GaugeField& out, const GaugeField& in) const override;
 };
@@ -138,6 +217,49 @@ public:
 ////////////////////////////////////////////////////////////////////////////////
 // Implementations
 ////////////////////////////////////////////////////////////////////////////////
+template <class Gimpl>
+void WilsonFlowBase<Gimpl>::flowForce(GaugeField &Z, const GaugeField &U) const{
+  switch(action){
+  case FlowAction::Wilson:
+    SG.deriv(U, Z);
+    break;
+  case FlowAction::Symanzik:
+    SS.deriv(U, Z);
+    break;
+  case FlowAction::Zeuthen:
+    SS.deriv(U, Z);
+    zeuthenCorrection(Z, U);
+    break;
+  }
+}
+
+//D*_mu D_mu Z_mu(x) = U_mu(x) Z_mu(x+mu) U^dag_mu(x) + U^dag_mu(x-mu) Z_mu(x-mu) U_mu(x-mu) - 2 Z_mu(x)
+template <class Gimpl>
+void WilsonFlowBase<Gimpl>::zeuthenCorrection(GaugeField &Z, const GaugeField &U){
+  GaugeLinkField Umu(U.Grid()), Zmu(U.Grid()), ZU(U.Grid()), DZ(U.Grid());
+  for(int mu=0;mu<Nd;mu++){
+    Umu = PeekIndex<LorentzIndex>(U, mu);
+    Zmu = PeekIndex<LorentzIndex>(Z, mu);
+    ZU  = Zmu*Umu;
+    DZ = Gimpl::CovShiftForward(Umu, mu, Zmu)*adj(Umu) + Gimpl::CovShiftBackward(Umu, mu, ZU) - 2.0*Zmu;
+    Zmu = Zmu + (1.0/12.0)*DZ;
+    PokeIndex<LorentzIndex>(Z, Zmu, mu);
+  }
+}
+
+template <class Gimpl>
+RealD WilsonFlowBase<Gimpl>::flowDistance(const GaugeField &U, const GaugeField &V){
+  GaugeField diffU = U - V;
+  RealD max_dist = 0;
+
+  for(int mu=0;mu<Nd;mu++){
+    typename Gimpl::GaugeLinkField diffU_mu = PeekIndex<LorentzIndex>(diffU, mu);
+    RealD dist_mu = sqrt( maxLocalNorm2(diffU_mu) ) /Nc/Nc; //maximize over sites
+    max_dist = std::max(max_dist, dist_mu); //maximize over mu
+  }
+  return max_dist;
+}
+
 template <class Gimpl>
 RealD WilsonFlowBase<Gimpl>::energyDensityPlaquette(const RealD t, const GaugeField& U){
   static WilsonGaugeAction<Gimpl> SG(3.0);
@@ -169,6 +291,38 @@ RealD WilsonFlowBase<Gimpl>::energyDensityCloverleaf(const RealD t, const GaugeF
   return -real(out); //minus sign necessary for +ve energy
 }
 
+template <class Gimpl>
+void WilsonFlowBase<Gimpl>::timesliceFlowObservables(const RealD t, const GaugeField& U,
+						      std::vector<RealD> &Eplaq, std::vector<RealD> &Eclov, std::vector<RealD> &Q,
+						      typename WilsonLoops<Gimpl>::CloverObservablesWorkspace &wk){
+  std::vector<RealD> plaq;
+  WilsonLoops<Gimpl>::TimesliceCloverObservables(plaq, Eclov, Q, U, wk);
+
+  //Same normalisation as energyDensityPlaquette: 2 t^2 S_W/V at beta = 3
+  RealD beta  = 3.0;
+  RealD faces = (1.0 * Nd * (Nd - 1)) / 2.0;
+  RealD vol_t = U.Grid()->gSites() / RealD(plaq.size());
+  Eplaq.resize(plaq.size());
+  for(int tt=0;tt<plaq.size();tt++){
+    RealD p = plaq[tt] / vol_t / faces;
+    Eplaq[tt] = 2.0 * t * t * beta * (1.0 - p) * faces;
+    Eclov[tt] = t * t * Eclov[tt] / vol_t;
+  }
+}
+
+template <class Gimpl>
+void WilsonFlowBase<Gimpl>::flowObservables(const RealD t, const GaugeField& U, RealD &Eplaq, RealD &Eclov, RealD &Q,
+					     typename WilsonLoops<Gimpl>::CloverObservablesWorkspace &wk){
+  std::vector<RealD> Eplaq_t, Eclov_t, Q_t;
+  timesliceFlowObservables(t, U, Eplaq_t, Eclov_t, Q_t, wk);
+  int Nt = Q_t.size();
+  Eplaq = Eclov = Q = 0.0;
+  for(int tt=0;tt<Nt;tt++){
+    Eplaq += Eplaq_t[tt] / Nt;
+    Eclov += Eclov_t[tt] / Nt;
+    Q     += Q_t[tt];
+  }
+}
 
 template <class Gimpl>
 std::vector<RealD> WilsonFlowBase<Gimpl>::flowMeasureEnergyDensityPlaquette(GaugeField &V, const GaugeField& U, int measure_interval){
@@ -192,9 +346,12 @@ template <class Gimpl>
 std::vector<RealD> WilsonFlowBase<Gimpl>::flowMeasureEnergyDensityCloverleaf(GaugeField &V, const GaugeField& U, int measure_interval){
   std::vector<RealD> out;
   resetActions();
-  addMeasurement(measure_interval, [&out](int step, RealD t, const typename Gimpl::GaugeField &U){ 
+  auto wk = std::make_shared<typename WilsonLoops<Gimpl>::CloverObservablesWorkspace>();
+  addMeasurement(measure_interval, [&out,wk](int step, RealD t, const typename Gimpl::GaugeField &U){ 
       std::cout << GridLogMessage << "[WilsonFlow] Computing Cloverleaf energy density for step " << step << std::endl;
-      out.push_back( energyDensityCloverleaf(t,U) );
+      RealD Eplaq, Eclov, Q;
+      flowObservables(t,U,Eplaq,Eclov,Q,*wk);
+      out.push_back( Eclov );
     });      
   smear(V,U);
   return out;
@@ -208,11 +365,15 @@ std::vector<RealD> WilsonFlowBase<Gimpl>::flowMeasureEnergyDensityCloverleaf(con
 
 template <class Gimpl>
 void WilsonFlowBase<Gimpl>::setDefaultMeasurements(int topq_meas_interval){
-  addMeasurement(1, [](int step, RealD t, const typename Gimpl::GaugeField &U){
-      std::cout << GridLogMessage << "[WilsonFlow] Energy density (plaq) : "  << step << "  " << t << "  " << energyDensityPlaquette(t,U) << std::endl;
-    });
-  addMeasurement(topq_meas_interval, [](int step, RealD t, const typename Gimpl::GaugeField &U){
-      std::cout << GridLogMessage << "[WilsonFlow] Top. charge           : "  << step << "  " << WilsonLoops<Gimpl>::TopologicalCharge(U) << std::endl;
+  //One pass gives all three; the workspace keeps the padded cell and stencil across steps
+  auto wk = std::make_shared<typename WilsonLoops<Gimpl>::CloverObservablesWorkspace>();
+  addMeasurement(1, [wk,topq_meas_interval](int step, RealD t, const typename Gimpl::GaugeField &U){
+      RealD Eplaq, Eclov, Q;
+      flowObservables(t,U,Eplaq,Eclov,Q,*wk);
+      std::cout << GridLogMessage << "[WilsonFlow] Energy density (plaq) : "  << step << "  " << t << "  " << Eplaq << std::endl;
+      std::cout << GridLogMessage << "[WilsonFlow] Energy density (clov) : "  << step << "  " << t << "  " << Eclov << std::endl;
+      if( step % topq_meas_interval == 0 )
+	std::cout << GridLogMessage << "[WilsonFlow] Top. charge           : "  << step << "  " << Q << std::endl;
     });
 }
 
@@ -222,17 +383,17 @@ template <class Gimpl>
 void WilsonFlow<Gimpl>::evolve_step(typename Gimpl::GaugeField &U, RealD &tau) const{
   GaugeField Z(U.Grid());
   GaugeField tmp(U.Grid());
-  this->SG.deriv(U, Z);
+  this->flowForce(Z, U);
   Z *= 0.25;                                  // Z0 = 1/4 * F(U)
   Gimpl::update_field(Z, U, -2.0*epsilon);    // U = W1 = exp(ep*Z0)*W0
 
   Z *= -17.0/8.0;
-  this->SG.deriv(U, tmp); Z += tmp;                 // -17/32*Z0 +Z1
+  this->flowForce(tmp, U); Z += tmp;                 // -17/32*Z0 +Z1
   Z *= 8.0/9.0;                               // Z = -17/36*Z0 +8/9*Z1
   Gimpl::update_field(Z, U, -2.0*epsilon);    // U_= W2 = exp(ep*Z)*W1
 
   Z *= -4.0/3.0;
-  this->SG.deriv(U, tmp); Z += tmp;                 // 4/3*(17/36*Z0 -8/9*Z1) +Z2
+  this->flowForce(tmp, U); Z += tmp;                 // 4/3*(17/36*Z0 -8/9*Z1) +Z2
   Z *= 3.0/4.0;                               // Z = 17/36*Z0 -8/9*Z1 +3/4*Z2
   Gimpl::update_field(Z, U, -2.0*epsilon);    // V(t+e) = exp(ep*Z)*W2
   tau += epsilon;
@@ -277,20 +438,20 @@ int WilsonFlowAdaptive<Gimpl>::evolve_step_adaptive(typename Gimpl::GaugeField &
   Uprime = U;
   Usave = U;
 
-  this->SG.deriv(U, Z);
+  this->flowForce(Z, U);
   Zprime = -Z;
   Z *= 0.25;                                  // Z0 = 1/4 * F(U)
   Gimpl::update_field(Z, U, -2.0*eps);    // U = W1 = exp(ep*Z0)*W0
 
   Z *= -17.0/8.0;
-  this->SG.deriv(U, tmp); Z += tmp;                 // -17/32*Z0 +Z1
+  this->flowForce(tmp, U); Z += tmp;                 // -17/32*Z0 +Z1
   Zprime += 2.0*tmp;
   Z *= 8.0/9.0;                               // Z = -17/36*Z0 +8/9*Z1
   Gimpl::update_field(Z, U, -2.0*eps);    // U_= W2 = exp(ep*Z)*W1
     
 
   Z *= -4.0/3.0;
-  this->SG.deriv(U, tmp); Z += tmp;                 // 4/3*(17/36*Z0 -8/9*Z1) +Z2
+  this->flowForce(tmp, U); Z += tmp;                 // 4/3*(17/36*Z0 -8/9*Z1) +Z2
   Z *= 3.0/4.0;                               // Z = 17/36*Z0 -8/9*Z1 +3/4*Z2
   Gimpl::update_field(Z, U, -2.0*eps);    // V(t+e) = exp(ep*Z)*W2
 
@@ -298,14 +459,7 @@ int WilsonFlowAdaptive<Gimpl>::evolve_step_adaptive(typename Gimpl::GaugeField &
   Gimpl::update_field(Zprime, Uprime, -2.0*eps); // V'(t+e) = exp(ep*Z')*W0
 
   // Compute distance using Ramos' definition
-  GaugeField diffU = U - Uprime;
-  RealD max_dist = 0;
-
-  for(int mu=0;mu<Nd;mu++){
-    typename Gimpl::GaugeLinkField diffU_mu = PeekIndex<LorentzIndex>(diffU, mu);
-    RealD dist_mu = sqrt( maxLocalNorm2(diffU_mu) ) /Nc/Nc; //maximize over sites
-    max_dist = std::max(max_dist, dist_mu); //maximize over mu
-  }
+  RealD max_dist = this->flowDistance(U, Uprime);
   
   int ret;
   if(max_dist < tolerance) {
@@ -346,5 +500,117 @@ void WilsonFlowAdaptive<Gimpl>::smear(GaugeField& out, const GaugeField& in) con
 
 
 
+template <class Gimpl>
+void WilsonFlowCF4<Gimpl>::evolve_step(typename Gimpl::GaugeField &U, RealD &tau) const{
+  GaugeField F1(U.Grid()), F2(U.Grid()), F3(U.Grid()), F4(U.Grid());
+  GaugeField Z(U.Grid()), Y2(U.Grid()), Y(U.Grid());
+
+  // update_field(Z,U,ep) is U -> exp(ep Z) U and the flow is dU/dt = -2 Z(U) U
+  this->flowForce(F1, U);
+  Y2 = U; Gimpl::update_field(F1, Y2, -epsilon);        // Y2 = exp(h/2 F1) U
+  this->flowForce(F2, Y2);
+  Y = U;  Gimpl::update_field(F2, Y, -epsilon);         // Y3 = exp(h/2 F2) U
+  this->flowForce(F3, Y);
+  Z = F3 - 0.5*F1;
+  Y = Y2; Gimpl::update_field(Z, Y, -2.0*epsilon);      // Y4 = exp(h F3 - h/2 F1) Y2
+  this->flowForce(F4, Y);
+
+  Z = (1.0/12.0)*(3.0*F1 + 2.0*F2 + 2.0*F3 - F4);
+  Gimpl::update_field(Z, U, -2.0*epsilon);
+  Z = (1.0/12.0)*(-F1 + 2.0*F2 + 2.0*F3 + 3.0*F4);
+  Gimpl::update_field(Z, U, -2.0*epsilon);
+  tau += epsilon;
+}
+
+template <class Gimpl>
+void WilsonFlowCF4<Gimpl>::smear(GaugeField& out, const GaugeField& in) const{
+  std::cout << GridLogMessage
+	    << "[WilsonFlowCF4] Nstep   : " << Nstep << std::endl;
+  std::cout << GridLogMessage
+	    << "[WilsonFlowCF4] epsilon : " << epsilon << std::endl;
+  std::cout << GridLogMessage
+	    << "[WilsonFlowCF4] full trajectory : " << Nstep * epsilon << std::endl;
+
+  out = in;
+  RealD taus = 0.;
+  for (unsigned int step = 1; step <= Nstep; step++) {
+    evolve_step(out, taus);
+    for(auto const &meas : this->functions)
+      if( step % meas.first == 0 ) meas.second(step,taus,out);
+  }
+}
+
+template <class Gimpl>
+int WilsonFlowCF4Adaptive<Gimpl>::evolve_step_adaptive(typename Gimpl::GaugeField &U, typename Gimpl::GaugeField &F1, RealD &tau, RealD &eps) const{
+  if (maxTau - tau < eps){
+    eps = maxTau-tau;
+  }
+  GaugeField F2(U.Grid()), F3(U.Grid()), F4(U.Grid()), F5(U.Grid());
+  GaugeField Z(U.Grid()), Y2(U.Grid()), Y(U.Grid()), Ulow(U.Grid());
+
+  Y2 = U; Gimpl::update_field(F1, Y2, -eps);            // Y2 = exp(h/2 F1) U
+  this->flowForce(F2, Y2);
+  Y = U;  Gimpl::update_field(F2, Y, -eps);             // Y3 = exp(h/2 F2) U
+  this->flowForce(F3, Y);
+  Z = F3 - 0.5*F1;
+  Y = Y2; Gimpl::update_field(Z, Y, -2.0*eps);          // Y4 = exp(h F3 - h/2 F1) Y2
+  this->flowForce(F4, Y);
+
+  // Fourth order solution
+  Z = (1.0/12.0)*(3.0*F1 + 2.0*F2 + 2.0*F3 - F4);
+  Y = U; Gimpl::update_field(Z, Y, -2.0*eps);
+  Z = (1.0/12.0)*(-F1 + 2.0*F2 + 2.0*F3 + 3.0*F4);
+  Gimpl::update_field(Z, Y, -2.0*eps);
+  this->flowForce(F5, Y);
+
+  // Embedded third order solution
+  Z = (1.0/12.0)*(3.0*F1 + 2.0*F2 + 2.0*F3 - F5);
+  Ulow = U; Gimpl::update_field(Z, Ulow, -2.0*eps);
+  Z = (1.0/12.0)*(-F1 + 2.0*F2 + 2.0*F3 + 3.0*F5);
+  Gimpl::update_field(Z, Ulow, -2.0*eps);
+
+  RealD max_dist = this->flowDistance(Y, Ulow);
+
+  int ret;
+  if(max_dist < tolerance) {
+    U  = Y;
+    F1 = F5;
+    tau += eps;
+    ret = 1;
+  } else {
+    ret = 0;
+  }
+  eps = eps*0.95*std::pow(tolerance/max_dist,1./4.);
+  std::cout << GridLogMessage << "Adaptive CF4 smearing : Distance: "<< max_dist <<" Step successful: " << ret << " New epsilon: " << eps << std::endl; 
+
+  return ret;
+}
+
+template <class Gimpl>
+void WilsonFlowCF4Adaptive<Gimpl>::smear(GaugeField& out, const GaugeField& in) const{
+  std::cout << GridLogMessage
+	    << "[WilsonFlowCF4] initial epsilon : " << init_epsilon << std::endl;
+  std::cout << GridLogMessage
+	    << "[WilsonFlowCF4] full trajectory : " << maxTau << std::endl;
+  std::cout << GridLogMessage
+	    << "[WilsonFlowCF4] tolerance   : " << tolerance << std::endl;
+  out = in;
+  RealD taus = 0.;
+  RealD eps = init_epsilon;
+  unsigned int step = 0;
+  GaugeField F1(in.Grid());
+  this->flowForce(F1, out);
+  do{
+    int step_success = evolve_step_adaptive(out, F1, taus, eps); 
+    step += step_success; //step will not be incremented if the integration step fails
+
+    //Perform measurements
+    if(step_success)
+      for(auto const &meas : this->functions)
+	if( step % meas.first == 0 ) meas.second(step,taus,out);
+  } while (taus < maxTau);
+}
+
+
 NAMESPACE_END(Grid);
 
@@ -243,11 +243,162 @@ class GaugeGroup {
     out *= ci;
   }
 
+  // Gaussian algebra valued matrices for all Nd directions in a single pass
+  // over the lattice. The site generators are drawn in the same order as Nd
+  // successive calls of GaussianFundamentalLieAlgebraMatrix (mu outer,
+  // generator inner), so the momenta agree with the per direction loop to
+  // rounding; rescale is applied after the factor i*scale, as a caller
+  // multiplying the result would.
+  template <class vComplex_t>
+  static void GaussianFundamentalLieAlgebraMatrix(GridParallelRNG &pRNG,
+                                                  Lattice<iVector<iScalar<iMatrix<vComplex_t, ncolour> >, Nd> > &out,
+                                                  Real scale = 1.0, Real rescale = 1.0) {
+    typedef Lattice<iVector<iScalar<iMatrix<vComplex_t, ncolour> >, Nd> > Field;
+    typedef typename Field::scalar_object scalar_object;
+    typedef typename Field::scalar_type scalar_type;
+
+    GridBase *grid = out.Grid();
+    const int Nsimd = grid->Nsimd();
+    const int nword = Nd * AlgebraDimension;
+
+    const SparseGenerators &gen = sparseGenerators();
+    const int *nnz = &gen.nnz[0];
+    const GeneratorEntry *entries = &gen.entries[0];
+    Complex ci(0.0, scale);
+
+    autoView(out_v, out, CpuWrite);
+    pRNG.fillSequence(grid, nword, pRNG._gaussian, [&](int sm, const RealD *draws) {
+      ExtractBuffer<scalar_object> buf(Nsimd);
+      for (int si = 0; si < Nsimd; si++) {
+        scalar_object &site = buf[si];
+        zeroit(site);
+        for (int mu = 0; mu < Nd; mu++) {
+          auto &m = site._internal[mu]._internal._internal;
+          for (int a = 0; a < AlgebraDimension; a++) {
+            Real ca = draws[(mu * AlgebraDimension + a) * Nsimd + si];
+            const GeneratorEntry *e = &entries[a * MaxGeneratorEntries];
+            for (int n = 0; n < nnz[a]; n++) {
+              m[e[n].row][e[n].col] += scalar_type(ca * e[n].val);
+            }
+          }
+          for (int i = 0; i < ncolour; i++)
+            for (int j = 0; j < ncolour; j++) {
+              m[i][j] = m[i][j] * scalar_type(ci);
+              m[i][j] = m[i][j] * scalar_type(rescale);
+            }
+        }
+      }
+      merge(out_v[sm], buf);
+    });
+  }
+
+  // Sparse form of the generators: each Ta has at most ncolour non-zero
+  // entries, stored as (row, col, value) triplets
+  struct GeneratorEntry {
+    int row;
+    int col;
+    Complex val;
+  };
+  static const int MaxGeneratorEntries = ncolour;
+
+  static int generatorSparse(int lieIndex, GeneratorEntry *entries) {
+    Matrix ta;
+    generator(lieIndex, ta);
+    int nnz = 0;
+    for (int i = 0; i < ncolour; i++)
+      for (int j = 0; j < ncolour; j++) {
+        if (ta()()(i, j) != Complex(0.0)) {
+          assert(nnz < MaxGeneratorEntries);
+          entries[nnz].row = i;
+          entries[nnz].col = j;
+          entries[nnz].val = ta()()(i, j);
+          nnz++;
+        }
+      }
+    return nnz;
+  }
+
+  struct SparseGenerators {
+    Vector<int> nnz;
+    Vector<GeneratorEntry> entries;
+    SparseGenerators() : nnz(AlgebraDimension), entries(AlgebraDimension * MaxGeneratorEntries) {
+      for (int a = 0; a < AlgebraDimension; a++)
+        nnz[a] = generatorSparse(a, &entries[a * MaxGeneratorEntries]);
+    }
+  };
+
+  // generators are tabulated once and kept for the site kernels below
+  static const SparseGenerators &sparseGenerators(void) {
+    static SparseGenerators table;
+    return table;
+  }
+
   static void FundamentalLieAlgebraMatrix(const LatticeAlgebraVector &h,
                                           LatticeMatrix &out,
                                           Real scale = 1.0) {
     conformable(h, out);
     GridBase *grid = out.Grid();
+    const SparseGenerators &table = sparseGenerators();
+    auto nnz_p = &table.nnz[0];
+    auto ent_p = &table.entries[0];
+    Complex ci(0.0, scale);
+
+    // out = i scale sum_a h_a Ta, in a single sweep
+    autoView(h_v, h, AcceleratorRead);
+    autoView(out_v, out, AcceleratorWrite);
+    accelerator_for(ss, grid->oSites(), grid->Nsimd(), {
+      auto h_s = coalescedRead(h_v[ss]);
+      typedef decltype(coalescedRead(out_v[0])) MatrixSite;
+      MatrixSite out_s = Zero();
+      for (int a = 0; a < AlgebraDimension; a++) {
+        auto ha = h_s()()(a) * ci;
+        for (int p = 0; p < nnz_p[a]; p++) {
+          const GeneratorEntry &e = ent_p[a * MaxGeneratorEntries + p];
+          out_s()()(e.row, e.col) = out_s()()(e.row, e.col) + ha * e.val;
+        }
+      }
+      coalescedWrite(out_v[ss], out_s);
+    });
+  }
+
+  // Projects the algebra components a lattice matrix (of dimension ncol*ncol -1
+  // ) inverse operation: FundamentalLieAlgebraMatrix
+  static void projectOnAlgebra(LatticeAlgebraVector &h_out,
+                               const LatticeMatrix &in, Real scale = 1.0) {
+    conformable(h_out, in);
+    GridBase *grid = in.Grid();
+    const SparseGenerators &table = sparseGenerators();
+    auto nnz_p = &table.nnz[0];
+    auto ent_p = &table.entries[0];
+    Complex coefficient(0.0, -2.0 * scale);
+
+    // h_a = -2 scale tr(i Ta in), with the trace restricted to the
+    // non-zero entries of Ta
+    autoView(in_v, in, AcceleratorRead);
+    autoView(h_v, h_out, AcceleratorWrite);
+    accelerator_for(ss, grid->oSites(), grid->Nsimd(), {
+      auto in_s = coalescedRead(in_v[ss]);
+      typedef decltype(coalescedRead(h_v[0])) AlgebraSite;
+      AlgebraSite h_s;
+      for (int a = 0; a < AlgebraDimension; a++) {
+        auto tr = in_s()()(0, 0);
+        tr = Zero();
+        for (int p = 0; p < nnz_p[a]; p++) {
+          const GeneratorEntry &e = ent_p[a * MaxGeneratorEntries + p];
+          tr = tr + in_s()()(e.col, e.row) * e.val;
+        }
+        h_s()()(a) = tr * coefficient;
+      }
+      coalescedWrite(h_v[ss], h_s);
+    });
+  }
+
+  // Lattice-wide reference versions of the above, one sweep per generator
+  static void FundamentalLieAlgebraMatrixReference(const LatticeAlgebraVector &h,
+                                                   LatticeMatrix &out,
+                                                   Real scale = 1.0) {
+    conformable(h, out);
+    GridBase *grid = out.Grid();
     LatticeMatrix la(grid);
     Matrix ta;
 
@@ -259,10 +410,8 @@ class GaugeGroup {
     }
   }
 
-  // Projects the algebra components a lattice matrix (of dimension ncol*ncol -1
-  // ) inverse operation: FundamentalLieAlgebraMatrix
-  static void projectOnAlgebra(LatticeAlgebraVector &h_out,
-                               const LatticeMatrix &in, Real scale = 1.0) {
+  static void projectOnAlgebraReference(LatticeAlgebraVector &h_out,
+                                        const LatticeMatrix &in, Real scale = 1.0) {
     conformable(h_out, in);
     h_out = Zero();
     Matrix Ta;
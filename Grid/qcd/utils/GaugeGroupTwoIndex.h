@@ -196,6 +196,34 @@ public:
     }
   }
     
+  // Sparse form of the base: every e^(ij) is real with at most ncolour
+  // non-zero entries, stored as (row, col, value) triplets.
+  struct BaseEntry {
+    int row;
+    int col;
+    RealD val;
+  };
+  static const int MaxBaseEntries = ncolour;
+
+  static int baseSparse(int Index, BaseEntry *entries) {
+    MatrixD eij;
+    base(Index, eij);
+    int nnz = 0;
+    for (int i = 0; i < ncolour; i++)
+      for (int j = 0; j < ncolour; j++) {
+        RealD v = real(eij()()(i, j));
+        if (v != 0.0) {
+          assert(nnz < MaxBaseEntries);
+          assert(imag(eij()()(i, j)) == 0.0);
+          entries[nnz].row = i;
+          entries[nnz].col = j;
+          entries[nnz].val = v;
+          nnz++;
+        }
+      }
+    return nnz;
+  }
+
   static void printBase(void) {
     for (int gen = 0; gen < Dimension; gen++) {
       Matrix tmp;
@@ -279,21 +307,66 @@ public:
     std::cout << GridLogMessage << std::endl;
   }
 
+  // Sparse form of the two-index generators, tabulated once for the site
+  // kernels below; the bound on the number of entries is the dense one
+  struct GeneratorEntry {
+    int row;
+    int col;
+    Complex val;
+  };
+  static const int MaxGeneratorEntries = Dimension * Dimension;
+
+  struct SparseGenerators {
+    Vector<int> nnz;
+    Vector<GeneratorEntry> entries;
+    SparseGenerators() : nnz(NumGenerators), entries(NumGenerators * MaxGeneratorEntries) {
+      TIMatrix i2indTa;
+      for (int a = 0; a < NumGenerators; a++) {
+        generator(a, i2indTa);
+        GeneratorEntry *e = &entries[a * MaxGeneratorEntries];
+        nnz[a] = 0;
+        for (int i = 0; i < Dimension; i++)
+          for (int j = 0; j < Dimension; j++)
+            if (i2indTa()()(i, j) != Complex(0.0)) {
+              e[nnz[a]].row = i;
+              e[nnz[a]].col = j;
+              e[nnz[a]].val = i2indTa()()(i, j);
+              nnz[a]++;
+            }
+      }
+    }
+  };
+
+  static const SparseGenerators &sparseGenerators(void) {
+    static SparseGenerators table;
+    return table;
+  }
+
   static void TwoIndexLieAlgebraMatrix(
       const typename GaugeGroup<ncolour, group_name>::LatticeAlgebraVector &h,
       LatticeTwoIndexMatrix &out, Real scale = 1.0) {
     conformable(h, out);
     GridBase *grid = out.Grid();
-    LatticeTwoIndexMatrix la(grid);
-    TIMatrix i2indTa;
-
-    out = Zero();
-    for (int a = 0; a < NumGenerators; a++) {
-      generator(a, i2indTa);
-      la = peekColour(h, a) * i2indTa;
-      out += la;
-    }
-    out *= scale;
+    const SparseGenerators &table = sparseGenerators();
+    auto nnz_p = &table.nnz[0];
+    auto ent_p = &table.entries[0];
+
+    // out = scale sum_a h_a (iT_a), generators are already anti-hermitian
+    autoView(h_v, h, AcceleratorRead);
+    autoView(out_v, out, AcceleratorWrite);
+    accelerator_for(ss, grid->oSites(), grid->Nsimd(), {
+      auto h_s = coalescedRead(h_v[ss]);
+      typedef decltype(coalescedRead(out_v[0])) TwoIndexSite;
+      TwoIndexSite out_s = Zero();
+      for (int a = 0; a < NumGenerators; a++) {
+        auto ha = h_s()()(a) * scale;
+        for (int p = 0; p < nnz_p[a]; p++) {
+          const GeneratorEntry &e = ent_p[a * MaxGeneratorEntries + p];
+          out_s()()(e.row, e.col) = out_s()()(e.row, e.col) + ha * e.val;
+        }
+      }
+      coalescedWrite(out_v[ss], out_s);
+    });
   }
 
   // Projects the algebra components
@@ -302,39 +375,73 @@ public:
       typename GaugeGroup<ncolour, group_name>::LatticeAlgebraVector &h_out,
       const LatticeTwoIndexMatrix &in, Real scale = 1.0) {
     conformable(h_out, in);
-    h_out = Zero();
-    TIMatrix i2indTa;
+    GridBase *grid = in.Grid();
+    const SparseGenerators &table = sparseGenerators();
+    auto nnz_p = &table.nnz[0];
+    auto ent_p = &table.entries[0];
     Real coefficient = -2.0 / (ncolour + 2 * S) * scale;
     // 2/(Nc +/- 2) for the normalization of the trace in the two index rep
-    for (int a = 0; a < NumGenerators; a++) {
-      generator(a, i2indTa);
-      pokeColour(h_out, real(trace(i2indTa * in)) * coefficient, a);
-    }
+
+    autoView(in_v, in, AcceleratorRead);
+    autoView(h_v, h_out, AcceleratorWrite);
+    accelerator_for(ss, grid->oSites(), grid->Nsimd(), {
+      auto in_s = coalescedRead(in_v[ss]);
+      typedef decltype(coalescedRead(h_v[0])) AlgebraSite;
+      AlgebraSite h_s;
+      for (int a = 0; a < NumGenerators; a++) {
+        auto tr = in_s()()(0, 0);
+        tr = Zero();
+        for (int p = 0; p < nnz_p[a]; p++) {
+          const GeneratorEntry &e = ent_p[a * MaxGeneratorEntries + p];
+          tr = tr + in_s()()(e.col, e.row) * e.val;
+        }
+        h_s()()(a) = real(tr) * coefficient;
+      }
+      coalescedWrite(h_v[ss], h_s);
+    });
   }
 
   // a projector that keeps the generators stored to avoid the overhead of
-  // recomputing them
+  // recomputing them; the generators are now always tabulated, so this is
+  // the same as projectOnAlgebra
   static void projector(
       typename GaugeGroup<ncolour, group_name>::LatticeAlgebraVector &h_out,
       const LatticeTwoIndexMatrix &in, Real scale = 1.0) {
+    projectOnAlgebra(h_out, in, scale);
+  }
+
+  // Lattice-wide reference version of projectOnAlgebra, one sweep per
+  // generator
+  static void projectOnAlgebraReference(
+      typename GaugeGroup<ncolour, group_name>::LatticeAlgebraVector &h_out,
+      const LatticeTwoIndexMatrix &in, Real scale = 1.0) {
     conformable(h_out, in);
-    // to store the generators
-    static std::vector<TIMatrix> i2indTa(NumGenerators);
     h_out = Zero();
-    static bool precalculated = false;
-    if (!precalculated) {
-      precalculated = true;
-      for (int a = 0; a < NumGenerators; a++) generator(a, i2indTa[a]);
+    TIMatrix i2indTa;
+    Real coefficient = -2.0 / (ncolour + 2 * S) * scale;
+    for (int a = 0; a < NumGenerators; a++) {
+      generator(a, i2indTa);
+      pokeColour(h_out, real(trace(i2indTa * in)) * coefficient, a);
     }
+  }
 
-    Real coefficient =
-        -2.0 / (ncolour + 2 * S) * scale;  // 2/(Nc +/- 2) for the normalization
-    // of the trace in the two index rep
+  // Lattice-wide reference version of TwoIndexLieAlgebraMatrix, one sweep per
+  // generator
+  static void TwoIndexLieAlgebraMatrixReference(
+      const typename GaugeGroup<ncolour, group_name>::LatticeAlgebraVector &h,
+      LatticeTwoIndexMatrix &out, Real scale = 1.0) {
+    conformable(h, out);
+    GridBase *grid = out.Grid();
+    LatticeTwoIndexMatrix la(grid);
+    TIMatrix i2indTa;
 
+    out = Zero();
     for (int a = 0; a < NumGenerators; a++) {
-      auto tmp = real(trace(i2indTa[a] * in)) * coefficient;
-      pokeColour(h_out, tmp, a);
+      generator(a, i2indTa);
+      la = peekColour(h, a) * i2indTa;
+      out += la;
     }
+    out *= scale;
   }
 };
 
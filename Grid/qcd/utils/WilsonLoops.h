@@ -1361,6 +1361,154 @@ public:
 #endif
   }
 
+  //The four 1x1 leaves of the clover in each plane mu<nu, as used by FieldStrength:
+  //  A1 = U_mu(x)    U_nu(x+mu)       U^dag_mu(x+nu)   U^dag_nu(x)
+  //  A2 = U_mu(x)    U^dag_nu(x+mu-nu) U^dag_mu(x-nu)  U_nu(x-nu)
+  //  A3 = U_nu(x)    U^dag_mu(x+nu-mu) U^dag_nu(x-mu)  U_mu(x-mu)
+  //  A4 = U^dag_nu(x-nu) U^dag_mu(x-mu-nu) U_nu(x-mu-nu) U_mu(x-mu)
+  //with C_munu = A1 - A2 + A3 - A4 and F_munu = (C - C^dag)/8
+  class CloverLeavesWorkspace: public WilsonLoopPaddedStencilWorkspace{
+  public:
+    std::vector<Coordinate> getShifts() const override{
+      std::vector<Coordinate> shifts;
+      for(int mu=0;mu<Nd-1;mu++){
+	for(int nu=mu+1;nu<Nd;nu++){
+	  Coordinate shift_0(Nd,0);
+	  Coordinate shift_mu(Nd,0);     shift_mu[mu]=1;
+	  Coordinate shift_nu(Nd,0);     shift_nu[nu]=1;
+	  Coordinate shift_mmu(Nd,0);    shift_mmu[mu]=-1;
+	  Coordinate shift_mnu(Nd,0);    shift_mnu[nu]=-1;
+	  Coordinate shift_mu_mnu(Nd,0); shift_mu_mnu[mu]=1;  shift_mu_mnu[nu]=-1;
+	  Coordinate shift_mmu_nu(Nd,0); shift_mmu_nu[mu]=-1; shift_mmu_nu[nu]=1;
+	  Coordinate shift_mmu_mnu(Nd,0);shift_mmu_mnu[mu]=-1;shift_mmu_mnu[nu]=-1;
+
+	  //A1
+	  shifts.push_back(shift_0);
+	  shifts.push_back(shift_mu);
+	  shifts.push_back(shift_nu);
+	  shifts.push_back(shift_0);
+	  //A2
+	  shifts.push_back(shift_0);
+	  shifts.push_back(shift_mu_mnu);
+	  shifts.push_back(shift_mnu);
+	  shifts.push_back(shift_mnu);
+	  //A3
+	  shifts.push_back(shift_0);
+	  shifts.push_back(shift_mmu_nu);
+	  shifts.push_back(shift_mmu);
+	  shifts.push_back(shift_mmu);
+	  //A4
+	  shifts.push_back(shift_mnu);
+	  shifts.push_back(shift_mmu_mnu);
+	  shifts.push_back(shift_mmu_mnu);
+	  shifts.push_back(shift_mmu);
+	}
+      }
+      return shifts;
+    }
+
+    int paddingDepth() const override{ return 1; }
+  };
+
+  //A workspace for reusing the PaddedCell and GeneralLocalStencil objects of the clover observables
+  class CloverObservablesWorkspace: public WilsonLoopPaddedWorkspace{
+  public:
+    CloverObservablesWorkspace(){
+      this->addStencil(new CloverLeavesWorkspace);
+    }
+  };
+
+  //////////////////////////////////////////////////////
+  //Plaquette, clover energy density and clover topological charge by timeslice,
+  //from a single pass over the padded links and one global reduction
+  //plaq  : sum over the timeslice and the planes of ReTr P_munu / Nc
+  //energy: -sum over the timeslice and the planes of Tr F_munu F_munu
+  //charge: topological charge in the timeslice, as TopologicalCharge
+  /////////////////////////////////////////////////////
+  static void TimesliceCloverObservables(std::vector<RealD> &plaq, std::vector<RealD> &energy, std::vector<RealD> &charge,
+					 const GaugeLorentz &Umu){
+    CloverObservablesWorkspace wk;
+    TimesliceCloverObservables(plaq,energy,charge,Umu,wk);
+  }
+
+  static void TimesliceCloverObservables(std::vector<RealD> &plaq, std::vector<RealD> &energy, std::vector<RealD> &charge,
+					 const GaugeLorentz &Umu, CloverObservablesWorkspace &wk){
+    assert(Nd==4);
+    double t0 = usecond();
+
+    GridCartesian* unpadded_grid = dynamic_cast<GridCartesian*>(Umu.Grid());
+    const PaddedCell &Ghost = wk.getPaddedCell(unpadded_grid);
+    const GeneralLocalStencil &gStencil = wk.getStencil(0,unpadded_grid);
+    GridBase *ggrid = Ghost.grids.back();
+
+    CshiftImplGauge<Gimpl> cshift_impl;
+    std::vector<GaugeMat> U_pad(Nd, ggrid);
+    for(int mu=0;mu<Nd;mu++) U_pad[mu] = Ghost.Exchange(PeekIndex<LorentzIndex>(Umu,mu), cshift_impl);
+    double t1 = usecond();
+
+    typedef LatticeView<typename GaugeMat::vector_object> GaugeViewType;
+    size_t vsize = Nd*sizeof(GaugeViewType);
+    GaugeViewType* Ug_dirs_v_host = (GaugeViewType*)malloc(vsize);
+    for(int i=0;i<Nd;i++) Ug_dirs_v_host[i] = U_pad[i].View(AcceleratorRead);
+    GaugeViewType* Ug_dirs_v = (GaugeViewType*)acceleratorAllocDevice(vsize);
+    acceleratorCopyToDevice(Ug_dirs_v_host,Ug_dirs_v,vsize);
+
+    typedef Lattice<iVector<Simd,3> > ObservableField;
+    ObservableField gObs(ggrid);
+    {
+      autoView( gObs_v , gObs, AcceleratorWrite);
+      auto gStencil_v = gStencil.View(AcceleratorRead);
+
+      accelerator_for(ss, ggrid->oSites(), (size_t)ggrid->Nsimd(), {
+	  typedef decltype(coalescedRead(Ug_dirs_v[0][0])) MatType;
+	  MatType L[16];
+	  MatType F[6];
+	  decltype(coalescedRead(gObs_v[0])) obs;
+	  obs = Zero();
+	  int off = 0;
+	  int p = 0;
+	  for(int mu=0;mu<Nd-1;mu++){
+	    for(int nu=mu+1;nu<Nd;nu++){
+	      for(int i=0;i<16;i++){
+		GeneralStencilEntry const* e = gStencil_v.GetEntry(off++,ss);
+		int d = (((i>>3)&1) ^ (i&1)) ? nu : mu;
+		L[i] = coalescedReadGeneralPermute(Ug_dirs_v[d][e->_offset], e->_permute, Nd);
+	      }
+	      MatType A1 = L[0]*L[1]*adj(L[2])*adj(L[3]);
+	      MatType C  = A1
+		- L[4]*adj(L[5])*adj(L[6])*L[7]
+		+ L[8]*adj(L[9])*adj(L[10])*L[11]
+		- adj(L[12])*adj(L[13])*L[14]*L[15];
+	      F[p] = 0.125*(C - adj(C));
+	      obs(0) = obs(0) + TensorRemove(trace(A1));
+	      obs(1) = obs(1) - TensorRemove(trace(F[p]*F[p]));
+	      p++;
+	    }
+	  }
+	  // planes 01 02 03 12 13 23
+	  obs(2) = TensorRemove( trace(F[1]*F[4]) - trace(F[3]*F[2]) - trace(F[0]*F[5]) );
+	  coalescedWrite(gObs_v[ss],obs);
+	});
+    }
+    for(int i=0;i<Nd;i++) Ug_dirs_v_host[i].ViewClose();
+    free(Ug_dirs_v_host);
+    acceleratorFreeDevice(Ug_dirs_v);
+
+    ObservableField Obs = Ghost.Extract(gObs);
+    auto Tobs = sliceSum(Obs, Nd-1);
+
+    RealD coeff = 8.0/(32.0*M_PI*M_PI);
+    int Nt = Tobs.size();
+    plaq.resize(Nt); energy.resize(Nt); charge.resize(Nt);
+    for(int t=0;t<Nt;t++){
+      plaq[t]   = real(Tobs[t](0))/Nc;
+      energy[t] = real(Tobs[t](1));
+      charge[t] = coeff*real(Tobs[t](2));
+    }
+    double t2 = usecond();
+    std::cout << GridLogPerformance << "TimesliceCloverObservables timings: pad:" << (t1-t0)/1000 << "ms, observables:" << (t2-t1)/1000 << "ms" << std::endl;
+  }
+
   //////////////////////////////////////////////////
   // Wilson loop of size (R1, R2), oriented in mu,nu plane
   //////////////////////////////////////////////////
@@ -32,12 +32,14 @@ NAMESPACE_BEGIN(Grid);
 uint64_t DslashFullCount;
 uint64_t DslashPartialCount;
 uint64_t DslashDirichletCount;
+uint64_t DslashCommsBytes;
 
 void DslashResetCounts(void)
 {
   DslashFullCount=0;
   DslashPartialCount=0;
   DslashDirichletCount=0;
+  DslashCommsBytes=0;
 }
 void DslashGetCounts(uint64_t &dirichlet,uint64_t &partial,uint64_t &full)
 {
@@ -48,6 +50,8 @@ void DslashGetCounts(uint64_t &dirichlet,uint64_t &partial,uint64_t &full)
 void DslashLogFull(void)     { DslashFullCount++;}
 void DslashLogPartial(void)  { DslashPartialCount++;}
 void DslashLogDirichlet(void){ DslashDirichletCount++;}
+void DslashLogBytes(double bytes){ DslashCommsBytes+=(uint64_t)bytes;}
+void DslashGetCommsBytes(uint64_t &bytes) { bytes = DslashCommsBytes; }
 
 
 void Gather_plane_table_compute (GridBase *grid,int dimension,int plane,int cbmask,
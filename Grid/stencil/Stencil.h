@@ -75,6 +75,8 @@ void DslashGetCounts(uint64_t &dirichlet,uint64_t &partial,uint64_t &full);
 void DslashLogFull(void);
 void DslashLogPartial(void);
 void DslashLogDirichlet(void);
+void DslashLogBytes(double bytes); // off node bytes returned by StencilSendToRecvFromBegin
+void DslashGetCommsBytes(uint64_t &bytes);
 
 struct StencilEntry {
 #ifdef GRID_CUDA
@@ -372,12 +374,13 @@ public:
                                // But the HaloGather had a barrier too.
 #ifdef ACCELERATOR_AWARE_MPI
     for(int i=0;i<Packets.size();i++){
-      _grid->StencilSendToRecvFromBegin(MpiReqs,
+      double off_node = _grid->StencilSendToRecvFromBegin(MpiReqs,
 					Packets[i].send_buf,
 					Packets[i].to_rank,Packets[i].do_send,
 					Packets[i].recv_buf,
 					Packets[i].from_rank,Packets[i].do_recv,
 					Packets[i].xbytes,Packets[i].rbytes,i);
+      DslashLogBytes(off_node);
     }
 #else
 #warning "Using COPY VIA HOST BUFFERS IN STENCIL"
@@ -388,12 +391,13 @@ public:
       if ( Packets[i].do_send ) {
 	acceleratorCopyFromDevice(Packets[i].send_buf, Packets[i].host_send_buf,Packets[i].xbytes);
       }
-      _grid->StencilSendToRecvFromBegin(MpiReqs,
+      double off_node = _grid->StencilSendToRecvFromBegin(MpiReqs,
 					Packets[i].host_send_buf,
 					Packets[i].to_rank,Packets[i].do_send,
 					Packets[i].host_recv_buf,
 					Packets[i].from_rank,Packets[i].do_recv,
 					Packets[i].xbytes,Packets[i].rbytes,i);
+      DslashLogBytes(off_node);
     }
 #endif
     // Get comms started then run checksums
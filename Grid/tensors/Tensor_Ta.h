@@ -264,6 +264,62 @@ accelerator_inline iMatrix<vtype,N> ProjectOnSpGroup(const iMatrix<vtype,N> &arg
   return ret;
 }
 
+// Polar projection on Sp(2n): the nearest group element to a matrix already
+// close to the group, without the row ordering bias of Gram-Schmidt.
+//
+// Symmetrising onto the quaternionic form  ( W  X ; -X^*  W^* )  is exact and
+// the quaternionic matrices are closed under products and adjoints, so the
+// Newton-Schulz iteration for the unitary polar factor,
+//
+//   Y <- Y (3 - Y^dag Y) / 2 ,
+//
+// stays in that form and converges to the group (unitary and quaternionic is
+// Sp(2n)). Convergence is quadratic for singular values near 1, so a fixed
+// Niter with no branches suffices for links after an MD update or a
+// checkpoint read; it is not meant for matrices far from the group.
+template<class vtype,int N, typename std::enable_if< GridTypeMapper<vtype>::TensorLevel == 0 >::type * =nullptr>
+accelerator_inline void SymmetriseSpBlocks(iMatrix<vtype,N> &ret)
+{
+  for(int c1=0;c1<N/2;c1++){
+    for(int c2=0;c2<N/2;c2++){
+      vtype W = (ret._internal[c1][c2]     + conjugate(ret._internal[c1+N/2][c2+N/2]))*0.5;
+      vtype X = (ret._internal[c1][c2+N/2] - conjugate(ret._internal[c1+N/2][c2]))*0.5;
+      ret._internal[c1][c2]         = W;
+      ret._internal[c1][c2+N/2]     = X;
+      ret._internal[c1+N/2][c2]     = -conjugate(X);
+      ret._internal[c1+N/2][c2+N/2] = conjugate(W);
+    }
+  }
+}
+
+template<class vtype,int N, typename std::enable_if< GridTypeMapper<vtype>::TensorLevel == 0 >::type * =nullptr>
+accelerator_inline iMatrix<vtype,N> ProjectOnSpGroupPolar(const iMatrix<vtype,N> &arg, int Niter = 3)
+{
+  iMatrix<vtype,N> ret(arg);
+  iMatrix<vtype,N> three(3.0);
+  SymmetriseSpBlocks(ret);
+  for(int i=0;i<Niter;i++){
+    ret = ret * (three - adj(ret)*ret) * 0.5;
+  }
+  SymmetriseSpBlocks(ret);
+  return ret;
+}
+
+template<class vtype> accelerator_inline iScalar<vtype> ProjectOnSpGroupPolar(const iScalar<vtype>&r, int Niter = 3)
+{
+  iScalar<vtype> ret;
+  ret._internal = ProjectOnSpGroupPolar(r._internal, Niter);
+  return ret;
+}
+template<class vtype,int N> accelerator_inline iVector<vtype,N> ProjectOnSpGroupPolar(const iVector<vtype,N>&r, int Niter = 3)
+{
+  iVector<vtype,N> ret;
+  for(int i=0;i<N;i++){
+    ret._internal[i] = ProjectOnSpGroupPolar(r._internal[i], Niter);
+  }
+  return ret;
+}
+
 NAMESPACE_END(Grid);
 
 #endif
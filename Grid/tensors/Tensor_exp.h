@@ -52,6 +52,21 @@ template<class vtype, int N> accelerator_inline iVector<vtype, N> Exponentiate(c
   return ret;
 }
 
+template<class vtype> accelerator_inline iScalar<vtype> ExponentiateExact(const iScalar<vtype>&r, RealD alpha)
+{
+  iScalar<vtype> ret;
+  ret._internal = ExponentiateExact(r._internal, alpha);
+  return ret;
+}
+
+template<class vtype, int N> accelerator_inline iVector<vtype, N> ExponentiateExact(const iVector<vtype,N>&r, RealD alpha)
+{
+  iVector<vtype, N> ret;
+  for (int i = 0; i < N; i++)
+    ret._internal[i] = ExponentiateExact(r._internal[i], alpha);
+  return ret;
+}
+
 
 // Specialisation: Cayley-Hamilton exponential for SU(3)
 #if 0
@@ -136,6 +151,67 @@ accelerator_inline iMatrix<vtype,N> Exponentiate(const iMatrix<vtype,N> &arg, Re
 
 }
 
+// Exponential to working precision for any N, by scaling and squaring:
+//
+//   exp(alpha arg) = [ exp(alpha arg / 2^s) ]^(2^s)
+//
+// s is chosen from the Frobenius norm so that |alpha arg| / 2^s <= 0.8, where
+// the degree 16 Taylor remainder is below double precision rounding. The
+// series is evaluated Paterson-Stockmeyer style as a polynomial in X^4, so
+// the cost is 6 multiplies plus s squarings. All SIMD lanes square the same
+// number of times, set by the largest per-lane norm. No temporaries beyond a
+// few site matrices.
+template<class vtype,int N, typename std::enable_if< GridTypeMapper<vtype>::TensorLevel == 0 >::type * =nullptr> 
+accelerator_inline iMatrix<vtype,N> ExponentiateExact(const iMatrix<vtype,N> &arg, RealD alpha)
+{
+  typedef iMatrix<vtype,N> mat;
+  const int   degree = 16;
+  const RealD theta  = 0.8;
+
+  vtype inner;
+  zeroit(inner);
+  for(int i=0;i<N;i++){
+    for(int j=0;j<N;j++){
+      inner += innerProduct(arg._internal[i][j],arg._internal[i][j]);
+    }
+  }
+  RealD nrm2 = 0.0;
+  for(int l=0;l<iScalar<vtype>::Nsimd();l++){
+    RealD lane = real(getlane(inner,l));
+    if ( lane > nrm2 ) nrm2 = lane;
+  }
+  RealD nrm = fabs(alpha)*sqrt(nrm2);
+
+  int s = 0;
+  RealD scale = alpha;
+  while ( nrm > theta ) {
+    nrm   *= 0.5;
+    scale *= 0.5;
+    s++;
+  }
+
+  RealD c[degree+1];
+  c[0] = 1.0;
+  for(int k=1;k<=degree;k++) c[k] = c[k-1]/RealD(k);
+
+  mat unit(1.0);
+  mat X  = arg*scale;
+  mat X2 = X*X;
+  mat X3 = X2*X;
+  mat X4 = X2*X2;
+
+  // p(X) = C0 + X4 (C1 + X4 (C2 + X4 (C3 + X4 c16))),  Cj = sum_i c[4j+i] X^i
+  mat ret = unit*c[12] + X*c[13] + X2*c[14] + X3*c[15] + X4*c[16];
+  for(int j=2;j>=0;j--){
+    ret = unit*c[4*j] + X*c[4*j+1] + X2*c[4*j+2] + X3*c[4*j+3] + X4*ret;
+  }
+
+  for(int i=0;i<s;i++){
+    ret = ret*ret;
+  }
+  return ret;
+}
+
 NAMESPACE_END(Grid);
 
 #endif
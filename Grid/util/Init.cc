@@ -332,6 +332,21 @@ void Grid_init(int *argc,char ***argv)
     MemoryManager::DeviceMaxBytes = MB64*1024LL*1024LL;
   }
 
+  if( GridCmdOptionExists(*argv,*argv+*argc,"--host-pool") ){
+    int MB;
+    arg= GridCmdOptionPayload(*argv,*argv+*argc,"--host-pool");
+    GridCmdOptionInt(arg,MB);
+    uint64_t MB64 = MB;
+    MemoryManager::HostPoolMaxBytes = MB64*1024LL*1024LL;
+  }
+
+  if( GridCmdOptionExists(*argv,*argv+*argc,"--host-pool-hugepages") ){
+    int huge;
+    arg= GridCmdOptionPayload(*argv,*argv+*argc,"--host-pool-hugepages");
+    GridCmdOptionInt(arg,huge);
+    MemoryManager::HostPoolHugePages = huge;
+  }
+
   if( GridCmdOptionExists(*argv,*argv+*argc,"--hypercube") ){
     int enable;
     arg= GridCmdOptionPayload(*argv,*argv+*argc,"--hypercube");
@@ -452,6 +467,8 @@ void Grid_init(int *argc,char ***argv)
     std::cout<<GridLogMessage<<"  --shm-mpi 0|1   : Force MPI usage under multi-rank per node "<<std::endl;
     std::cout<<GridLogMessage<<"  --shm-hugepages : use explicit huge pages in mmap call "<<std::endl;
     std::cout<<GridLogMessage<<"  --device-mem M  : Size of device software cache for lattice fields (MB) "<<std::endl;
+    std::cout<<GridLogMessage<<"  --host-pool M   : Pool freed host lattice memory by size class, holding up to M MB "<<std::endl;
+    std::cout<<GridLogMessage<<"  --host-pool-hugepages 0|1|2 : host pool on no, transparent or explicit huge pages "<<std::endl;
     std::cout<<GridLogMessage<<std::endl;
     std::cout<<GridLogMessage<<"Verbose and debug:"<<std::endl;
     std::cout<<GridLogMessage<<std::endl;
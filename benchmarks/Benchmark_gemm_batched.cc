@@ -0,0 +1,165 @@
+/*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid
+
+    Source file: ./benchmarks/Benchmark_gemm_batched.cc
+
+    Copyright (C) 2023
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+#include <Grid/algorithms/blas/BatchedBlas.h>
+
+using namespace std;
+using namespace Grid;
+
+// Shapes of the GridBLAS::gemmBatched calls made by the multigrid code
+//  - GeneralCoarsenedMatrixMultiRHS : nbasis x nrhs x nbasis,  one per coarse site
+//  - MultiRHSBlockProject project   : V^dag F, nbasis x nrhs x block_vol*words
+//  - MultiRHSBlockProject promote   : V C,     block_vol*words x nrhs x nbasis
+//  - MultiRHSDeflation              : E^dag R, nev x nrhs x vol*words, single batch
+struct GemmShape {
+  std::string name;
+  GridBLASOperation_t OpA;
+  int m, n, k, batch;
+};
+
+template<class scalar> scalar randomScalar(std::mt19937 &gen)
+{
+  std::uniform_real_distribution<double> dist(-1.0,1.0);
+  if constexpr (is_complex<scalar>::value) {
+    double re = dist(gen);
+    double im = dist(gen);
+    return scalar(re,im);
+  } else {
+    return scalar(dist(gen));
+  }
+}
+
+template<class scalar>
+void benchmark_gemm(const std::string &type,const GemmShape &s,RealD tol)
+{
+  const int Nloop = 10;
+  const int nrhs  = s.n;
+  int64_t sizeA = (int64_t)s.m*s.k;
+  int64_t sizeB = (int64_t)s.k*s.n;
+  int64_t sizeC = (int64_t)s.m*s.n;
+
+  deviceVector<scalar> A(sizeA*s.batch);
+  deviceVector<scalar> B(sizeB*s.batch);
+  deviceVector<scalar> C(sizeC*s.batch);
+  deviceVector<scalar *> Ap(s.batch);
+  deviceVector<scalar *> Bp(s.batch);
+  deviceVector<scalar *> Cp(s.batch);
+
+  std::mt19937 gen(s.m+s.n+s.k);
+  std::vector<scalar> hA(sizeA*s.batch), hB(sizeB*s.batch);
+  for(auto &a : hA) a = randomScalar<scalar>(gen);
+  for(auto &b : hB) b = randomScalar<scalar>(gen);
+  acceleratorCopyToDevice(&hA[0],&A[0],hA.size()*sizeof(scalar));
+  acceleratorCopyToDevice(&hB[0],&B[0],hB.size()*sizeof(scalar));
+  for(int p=0;p<s.batch;p++){
+    scalar *Ah = &A[p*sizeA];
+    scalar *Bh = &B[p*sizeB];
+    scalar *Ch = &C[p*sizeC];
+    acceleratorPut(Ap[p],Ah);
+    acceleratorPut(Bp[p],Bh);
+    acceleratorPut(Cp[p],Ch);
+  }
+
+  GridBLAS BLAS;
+  BLAS.gemmBatched(s.OpA,GridBLAS_OP_N,s.m,nrhs,s.k,scalar(1.0),Ap,Bp,scalar(0.0),Cp);
+  BLAS.synchronise();
+
+  double t0=usecond();
+  for(int i=0;i<Nloop;i++){
+    BLAS.gemmBatched(s.OpA,GridBLAS_OP_N,s.m,nrhs,s.k,scalar(1.0),Ap,Bp,scalar(0.0),Cp);
+  }
+  BLAS.synchronise();
+  double t1=usecond();
+  double t = (t1-t0)/Nloop;
+
+  // Check the last batch entry against a plain triple loop
+  int p = s.batch-1;
+  int lda = (s.OpA==GridBLAS_OP_N) ? s.m : s.k;
+  std::vector<scalar> hC(sizeC);
+  acceleratorCopyFromDevice(&C[p*sizeC],&hC[0],sizeC*sizeof(scalar));
+  RealD err=0.0, nrm=0.0;
+  for(int mm=0;mm<s.m;mm++){
+    for(int nn=0;nn<s.n;nn++){
+      scalar c_mn(0.0);
+      for(int kk=0;kk<s.k;kk++){
+	scalar a = (s.OpA==GridBLAS_OP_N) ? hA[p*sizeA+mm+kk*lda] : hA[p*sizeA+kk+mm*lda];
+	if ( s.OpA==GridBLAS_OP_C ) a = conjugate(a);
+	c_mn += a*hB[p*sizeB+kk+nn*s.k];
+      }
+      err += std::norm(hC[mm+nn*s.m]-c_mn);
+      nrm += std::norm(c_mn);
+    }
+  }
+  err = std::sqrt(err/nrm);
+
+  int words = is_complex<scalar>::value ? 8 : 2;
+  double flops = 1.0*words*s.m*s.n*s.k*s.batch;
+  double bytes = 1.0*sizeof(scalar)*(sizeA+sizeB+sizeC)*s.batch;
+  std::cout<<GridLogMessage<<std::setprecision(3)
+	   <<std::setw(10)<<s.name<<"\t"<<type<<"\t"<<s.m<<"x"<<s.n<<"x"<<s.k<<" x "<<s.batch<<"\t"
+	   <<t<<" us\t"<<flops/t/1000.<<" GF/s\t"<<bytes/t/1000.<<" GB/s\t err "<<err<<std::endl;
+  assert(err < tol);
+}
+
+template<class scalar>
+void benchmark_gemm_shapes(const std::string &type,const std::vector<GemmShape> &shapes,RealD tol)
+{
+  for(auto &s : shapes){
+    benchmark_gemm<scalar>(type,s,tol);
+  }
+}
+
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  int64_t threads = GridThread::GetThreads();
+  std::cout<<GridLogMessage << "Grid is setup to use "<<threads<<" threads"<<std::endl;
+
+  const int nrhs      = 12;
+  const int words     = 12;      // colour-spin words per fine site
+  const int block_vol = 4*4*4*4;
+  const int coarse    = 4*4*4*4; // coarse sites per rank
+
+  std::vector<GemmShape> shapes;
+  for(int nbasis : {32,64}){
+    shapes.push_back({"coarse",  GridBLAS_OP_N, nbasis, nrhs, nbasis, coarse});
+    shapes.push_back({"project", GridBLAS_OP_C, nbasis, nrhs, block_vol*words, coarse/16});
+    shapes.push_back({"promote", GridBLAS_OP_N, block_vol*words, nrhs, nbasis, coarse/16});
+  }
+  shapes.push_back({"deflate", GridBLAS_OP_C, 128, nrhs, coarse*block_vol*words/16, 1});
+
+  std::cout<<GridLogMessage << "===================================================================================================="<<std::endl;
+  std::cout<<GridLogMessage << "= Benchmarking GridBLAS gemmBatched on multigrid shapes (m x n x k x batch)"<<std::endl;
+  std::cout<<GridLogMessage << "===================================================================================================="<<std::endl;
+
+  benchmark_gemm_shapes<ComplexD>("ComplexD",shapes,1.0e-12);
+  benchmark_gemm_shapes<ComplexF>("ComplexF",shapes,1.0e-3);
+  benchmark_gemm_shapes<RealD>   ("RealD",   shapes,1.0e-12);
+  benchmark_gemm_shapes<RealF>   ("RealF",   shapes,1.0e-3);
+
+  Grid_finalize();
+}
@@ -0,0 +1,270 @@
+/*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid
+
+    Source file: ./benchmarks/Benchmark_sp2n.cc
+
+    Copyright (C) 2015
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+// Stage by stage timings of the Sp(2N) HMC code paths.
+//
+// The gauge group kernels (update_field, ProjectOnSpGroup and the Wilson
+// gauge force) are templated on the matrix size, so Sp(4), Sp(6) and Sp(8)
+// are all run from one binary in both precisions. The fermion operators and
+// the two-index representations are built on LatticeGaugeField, so these run
+// at the configured Nc (--enable-Nc); the representation updates are only
+// available in the default precision.
+//
+// Flop counts are nominal (matrix multiplies only) and byte counts are the
+// minimal field traffic, as in Benchmark_wilson.
+
+static int64_t Nwarm=2;
+static int64_t Nloop=20;
+
+void Header(const std::string &title)
+{
+  std::cout<<GridLogMessage << "===================================================================================================="<<std::endl;
+  std::cout<<GridLogMessage << "= "<<title<<std::endl;
+  std::cout<<GridLogMessage << "===================================================================================================="<<std::endl;
+  std::cout<<GridLogMessage << std::setw(36)<<std::left<<"stage"<<std::setw(28)<<"variant"<<std::right
+	   << std::setw(14)<<"us/call"<<std::setw(14)<<"GFlop/s"<<std::setw(14)<<"GB/s"<<std::endl;
+  std::cout<<GridLogMessage << "----------------------------------------------------------------------------------------------------"<<std::endl;
+}
+
+void Report(const std::string &stage,const std::string &variant,double usec,double flops,double bytes)
+{
+  std::cout<<GridLogMessage << std::setw(36)<<std::left<<stage<<std::setw(28)<<variant<<std::right<<std::fixed<<std::setprecision(2)
+	   << std::setw(14)<<usec;
+  if ( flops > 0 ) std::cout << std::setw(14)<<flops/usec/1000.;
+  else             std::cout << std::setw(14)<<"-";
+  std::cout << std::setw(14)<<bytes/usec/1000.<<std::defaultfloat<<std::endl;
+}
+
+template<class Func>
+double TimePerCall(GridBase *grid,Func func)
+{
+  for(int64_t i=0;i<Nwarm;i++) func();
+  grid->Barrier();
+  double t0=usecond();
+  for(int64_t i=0;i<Nloop;i++) func();
+  grid->Barrier();
+  double t1=usecond();
+  return (t1-t0)/Nloop;
+}
+
+//////////////////////////////////////////////////////////////
+// Group kernels at Sp(N), any N, either precision
+//////////////////////////////////////////////////////////////
+// gridD is a double precision grid of the same lattice, used to draw the
+// configuration; the Sp(2N) projection is only provided in double
+template<int N,class vComplex_t>
+void BenchmarkGroup(GridCartesian *grid,GridCartesian *gridD,const std::string &prec)
+{
+  typedef PeriodicGaugeImpl<GaugeImplTypes<vComplex_t,N,12,Sp<N> > > Gimpl;
+  typedef typename Gimpl::GaugeField     GaugeField;
+  typedef typename Gimpl::GaugeLinkField GaugeLinkField;
+  typedef typename GaugeField::scalar_type Scalar;
+
+  std::string group = "Sp("+std::to_string(N)+") "+prec;
+  double vol   = grid->gSites();
+  double N3    = 1.0*N*N*N;
+  double link  = 1.0*N*N*sizeof(Scalar);
+
+  GridParallelRNG pRNG(grid); pRNG.SeedFixedIntegers(std::vector<int>({45,12,81,9}));
+
+  GaugeField U(grid), Uc(grid), P(grid), dSdU(grid);
+  {
+    typedef typename PeriodicGaugeImpl<GaugeImplTypes<vComplexD,N,12,Sp<N> > >::GaugeField GaugeFieldD;
+    GridParallelRNG pRNGD(gridD); pRNGD.SeedFixedIntegers(std::vector<int>({45,12,81,9}));
+    GaugeFieldD UD(gridD);
+    Sp<N>::HotConfiguration(pRNGD,UD);
+    precisionChange(U,UD);
+  }
+
+  GaugeLinkField Pmu(grid);
+  for(int mu=0;mu<Nd;mu++){
+    gaussian(pRNG,Pmu);
+    Pmu = Ta(Pmu);
+    PokeIndex<LorentzIndex>(P,Pmu,mu);
+  }
+
+  double t;
+
+  // exp(ep P) U as in the MD update; |ep P| is small enough that the
+  // exponential needs no squaring, leaving 6 multiplies plus the one by U
+  Uc = U;
+  t = TimePerCall(grid,[&](){ Gimpl::update_field(P,Uc,0.01); });
+  Report("update_field",group,t,vol*Nd*7*8*N3,vol*Nd*3*link);
+
+  t = TimePerCall(grid,[&](){ Uc = ProjectOnSpGroup(U); });
+  Report("ProjectOnSpGroup",group,t,vol*Nd*4*N3,vol*Nd*2*link);
+
+  // Three Newton-Schulz steps of two multiplies each
+  t = TimePerCall(grid,[&](){ Uc = ProjectOnSpGroupPolar(U); });
+  Report("ProjectOnSpGroupPolar",group,t,vol*Nd*6*8*N3,vol*Nd*2*link);
+
+  // Two staples of two multiplies per plane, then U*staple
+  WilsonGaugeAction<Gimpl> Action(6.8);
+  t = TimePerCall(grid,[&](){ Action.deriv(U,dSdU); });
+  Report("WilsonGaugeAction::deriv",group,t,vol*Nd*(4*(Nd-1)+1)*8*N3,vol*Nd*2*link);
+}
+
+//////////////////////////////////////////////////////////////
+// Wilson Dhop in a given representation, all kernel variants
+//////////////////////////////////////////////////////////////
+template<class Impl,class RepField>
+void BenchmarkDhop(const std::string &name,const RepField &Urep_in,GridCartesian *grid,GridRedBlackCartesian *rbgrid)
+{
+  typedef typename Impl::FermionField FermionField;
+  typedef typename Impl::GaugeField   GaugeField;
+  typedef typename FermionField::scalar_type Scalar;
+  const int Dimension = Impl::Dimension;
+
+  double vol   = grid->gSites();
+  double flops = vol*8.0*Dimension*(7+16*Dimension);
+  double bytes = vol*((2*Nd+1)*Ns*Dimension + 2*Nd*Dimension*Dimension)*sizeof(Scalar);
+
+  GaugeField Urep(grid);
+  precisionChange(Urep,Urep_in);
+
+  GridParallelRNG pRNG(grid); pRNG.SeedFixedIntegers(std::vector<int>({1,2,3,4}));
+  FermionField src(grid); gaussian(pRNG,src);
+  FermionField res(grid);
+
+  WilsonFermion<Impl> Dw(Urep,*grid,*rbgrid,0.1);
+
+  // The hand unrolled kernels assume three colours and the assembler
+  // kernels are only specialised for some implementations, so those are
+  // run only where they apply (asm only when requested with --dslash-asm).
+  int opt_save   = WilsonKernelsStatic::Opt;
+  int comms_save = WilsonKernelsStatic::Comms;
+
+  std::vector<std::pair<int,std::string> > opts;
+  opts.push_back(std::make_pair((int)WilsonKernelsStatic::OptGeneric,std::string("generic")));
+  if ( Dimension == 3 ) {
+    opts.push_back(std::make_pair((int)WilsonKernelsStatic::OptHandUnroll,std::string("unroll")));
+    if ( opt_save == WilsonKernelsStatic::OptInlineAsm )
+      opts.push_back(std::make_pair((int)WilsonKernelsStatic::OptInlineAsm,std::string("asm")));
+  }
+  std::vector<std::pair<int,std::string> > comms;
+  comms.push_back(std::make_pair((int)WilsonKernelsStatic::CommsAndCompute,std::string("overlap")));
+  comms.push_back(std::make_pair((int)WilsonKernelsStatic::CommsThenCompute,std::string("sequential")));
+
+  for(auto &o : opts){
+    for(auto &c : comms){
+      WilsonKernelsStatic::Opt   = o.first;
+      WilsonKernelsStatic::Comms = c.first;
+      double t = TimePerCall(grid,[&](){ Dw.Dhop(src,res,DaggerNo); });
+      Report("Dhop "+name,o.second+"/"+c.second,t,flops,bytes);
+    }
+  }
+
+  WilsonKernelsStatic::Opt   = opt_save;
+  WilsonKernelsStatic::Comms = comms_save;
+}
+
+//////////////////////////////////////////////////////////////
+// Representation update and force projection, default precision
+//////////////////////////////////////////////////////////////
+template<class Rep>
+void BenchmarkRepresentation(const std::string &name,const LatticeGaugeField &U)
+{
+  GridBase *grid = U.Grid();
+  const int Dimension = Rep::Dimension;
+
+  double vol   = grid->gSites();
+  double bytes = vol*Nd*(Nc*Nc+Dimension*Dimension)*sizeof(Complex);
+
+  Rep R(grid);
+
+  double t = TimePerCall(grid,[&](){ R.update_representation(U); });
+  Report("update_representation",name,t,0.0,bytes);
+
+  typename Rep::LatticeField force(grid);
+  force = R.U;
+  LatticeGaugeField out(grid);
+  t = TimePerCall(grid,[&](){ out = R.RtoFundamentalProject(force,1.0); });
+  Report("RtoFundamentalProject",name,t,0.0,bytes);
+}
+
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  Coordinate latt_size  = GridDefaultLatt();
+  Coordinate mpi_layout = GridDefaultMpi();
+
+  int64_t threads = GridThread::GetThreads();
+  std::cout<<GridLogMessage << "Grid is setup to use "<<threads<<" threads"<<std::endl;
+  std::cout<<GridLogMessage << "Lattice "<<latt_size<<", "<<Nloop<<" calls per measurement"<<std::endl;
+
+  GridCartesian         *GridD   = SpaceTimeGrid::makeFourDimGrid(latt_size,GridDefaultSimd(Nd,vComplexD::Nsimd()),mpi_layout);
+  GridRedBlackCartesian *RBGridD = SpaceTimeGrid::makeFourDimRedBlackGrid(GridD);
+  GridCartesian         *GridF   = SpaceTimeGrid::makeFourDimGrid(latt_size,GridDefaultSimd(Nd,vComplexF::Nsimd()),mpi_layout);
+  GridRedBlackCartesian *RBGridF = SpaceTimeGrid::makeFourDimRedBlackGrid(GridF);
+  GridCartesian         *UGrid   = SpaceTimeGrid::makeFourDimGrid(latt_size,GridDefaultSimd(Nd,vComplex::Nsimd()),mpi_layout);
+
+  Header("Sp(2N) gauge group kernels");
+  BenchmarkGroup<4,vComplexD>(GridD,GridD,"double");
+  BenchmarkGroup<6,vComplexD>(GridD,GridD,"double");
+  BenchmarkGroup<8,vComplexD>(GridD,GridD,"double");
+  BenchmarkGroup<4,vComplexF>(GridF,GridD,"single");
+  BenchmarkGroup<6,vComplexF>(GridF,GridD,"single");
+  BenchmarkGroup<8,vComplexF>(GridF,GridD,"single");
+
+#if (Config_Nc % 2 == 0)
+  GridParallelRNG pRNG(UGrid); pRNG.SeedFixedIntegers(std::vector<int>({45,12,81,9}));
+  LatticeGaugeField U(UGrid);
+  Sp<Nc>::HotConfiguration(pRNG,U);
+
+  Header("Sp("+std::to_string(Nc)+") fermion operators and representations");
+
+  BenchmarkDhop<SpWilsonImplD>          ("fund double",           U,GridD,RBGridD);
+  BenchmarkDhop<SpWilsonImplF>          ("fund single",           U,GridF,RBGridF);
+  BenchmarkDhop<SpWilsonCompressedImplD>("fund compressed double",U,GridD,RBGridD);
+  BenchmarkDhop<SpWilsonCompressedImplF>("fund compressed single",U,GridF,RBGridF);
+
+#if (Config_Nc > 2)
+  {
+    SpTwoIndexAntiSymmetricRepresentation R(UGrid);
+    R.update_representation(U);
+    BenchmarkDhop<SpWilsonTwoIndexAntiSymmetricImplD>("2AS double",R.U,GridD,RBGridD);
+    BenchmarkDhop<SpWilsonTwoIndexAntiSymmetricImplF>("2AS single",R.U,GridF,RBGridF);
+    BenchmarkRepresentation<SpTwoIndexAntiSymmetricRepresentation>("2AS",U);
+  }
+#endif
+  {
+    SpTwoIndexSymmetricRepresentation R(UGrid);
+    R.update_representation(U);
+    BenchmarkDhop<SpWilsonTwoIndexSymmetricImplD>("2S double",R.U,GridD,RBGridD);
+    BenchmarkDhop<SpWilsonTwoIndexSymmetricImplF>("2S single",R.U,GridF,RBGridF);
+    BenchmarkRepresentation<SpTwoIndexSymmetricRepresentation>("2S",U);
+  }
+#else
+  std::cout<<GridLogMessage << "Nc = "<<Nc<<" is odd: configure with an even --enable-Nc for the Sp(2N) fermion benchmarks"<<std::endl;
+#endif
+
+  Grid_finalize();
+}
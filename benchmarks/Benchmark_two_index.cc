@@ -0,0 +1,115 @@
+/*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid
+
+    Source file: ./benchmarks/Benchmark_two_index.cc
+
+    Copyright (C) 2015
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+#define LMAX (24)
+#define LMIN (8)
+#define LADD (8)
+
+// The two-index representations are built from LatticeGaugeField, so the
+// number of colours is fixed at configure time (--enable-Nc); Sp(4), Sp(6)
+// and SU(3) are benchmarked by rebuilding with the corresponding Nc.
+template <class Rep, class Group>
+void benchmark_two_index(const std::string &name)
+{
+  int64_t Nwarm=2;
+  int64_t Nloop=10;
+
+  Coordinate simd_layout = GridDefaultSimd(Nd,vComplex::Nsimd());
+  Coordinate mpi_layout  = GridDefaultMpi();
+
+  const int Dimension = Rep::Dimension;
+
+  std::cout<<GridLogMessage << "===================================================================================================="<<std::endl;
+  std::cout<<GridLogMessage << "= Benchmarking "<<name<<" update_representation, dimension "<<Dimension<<std::endl;
+  std::cout<<GridLogMessage << "===================================================================================================="<<std::endl;
+  std::cout<<GridLogMessage << "  L  "<<"\t\t"<<"kernel us"<<"\t"<<"kernel GB/s"<<"\t"<<"reference us"<<"\t"<<"speedup"<<"\t\t"<<"difference"<<std::endl;
+  std::cout<<GridLogMessage << "----------------------------------------------------------"<<std::endl;
+
+  for(int lat=LMIN;lat<=LMAX;lat+=LADD){
+
+    Coordinate latt_size  ({lat*mpi_layout[0],lat*mpi_layout[1],lat*mpi_layout[2],lat*mpi_layout[3]});
+    int64_t vol = latt_size[0]*latt_size[1]*latt_size[2]*latt_size[3];
+    GridCartesian     Grid(latt_size,simd_layout,mpi_layout);
+    GridParallelRNG   pRNG(&Grid);      pRNG.SeedFixedIntegers(std::vector<int>({45,12,81,9}));
+
+    LatticeGaugeField Umu(&Grid);
+    Group::HotConfiguration(pRNG,Umu);
+
+    Rep Kernel(&Grid);
+    Rep Reference(&Grid);
+
+    for(int64_t i=0;i<Nwarm;i++){
+      Kernel.update_representation(Umu);
+    }
+    double start=usecond();
+    for(int64_t i=0;i<Nloop;i++){
+      Kernel.update_representation(Umu);
+    }
+    double stop=usecond();
+    double t_kernel = (stop-start)/Nloop;
+
+    Reference.update_representation_reference(Umu);
+    start=usecond();
+    for(int64_t i=0;i<Nloop;i++){
+      Reference.update_representation_reference(Umu);
+    }
+    stop=usecond();
+    double t_reference = (stop-start)/Nloop;
+
+    typename Rep::LatticeField diff(&Grid);
+    diff = Kernel.U - Reference.U;
+    RealD err = std::sqrt(norm2(diff)/norm2(Reference.U));
+
+    double bytes=1.0*vol*Nd*(Nc*Nc+Dimension*Dimension)*sizeof(Complex);
+    std::cout<<GridLogMessage<<std::setprecision(3) << lat<<"\t\t"<<t_kernel<<"\t\t"<<bytes/t_kernel/1000.<<"\t\t"
+	     <<t_reference<<"\t\t"<<t_reference/t_kernel<<"\t\t"<<err<<std::endl;
+    assert(err < 1.0e-5);
+  }
+}
+
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  int64_t threads = GridThread::GetThreads();
+  std::cout<<GridLogMessage << "Grid is setup to use "<<threads<<" threads"<<std::endl;
+
+  benchmark_two_index<TwoIndexRep<Nc, Symmetric, GroupName::SU>, SU<Nc> >("SU(Nc) 2S");
+  benchmark_two_index<TwoIndexRep<Nc, AntiSymmetric, GroupName::SU>, SU<Nc> >("SU(Nc) 2AS");
+
+#if (Config_Nc % 2 == 0)
+  benchmark_two_index<TwoIndexRep<Nc, Symmetric, GroupName::Sp>, Sp<Nc> >("Sp(Nc) 2S");
+#endif
+#if (Config_Nc % 2 == 0) && (Config_Nc > 2)
+  benchmark_two_index<TwoIndexRep<Nc, AntiSymmetric, GroupName::Sp>, Sp<Nc> >("Sp(Nc) 2AS");
+#endif
+
+  Grid_finalize();
+}
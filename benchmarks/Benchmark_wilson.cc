@@ -256,5 +256,52 @@ int main (int argc, char ** argv)
   assert(fabs(err0) < 1.0e-3);
   assert(fabs(err1) < 1.0e-3);
 
+#if Sp2n_config
+  {
+    ////////////////////////////////////////////////////////////////////
+    // Sp(2N): full versus compressed (top N rows) double stored links
+    ////////////////////////////////////////////////////////////////////
+    std::cout<<GridLogMessage << "Benchmarking Sp("<<Nc<<") Wilson operator, full and compressed links" << std::endl;
+
+    LatticeGaugeField SpUmu(&Grid);
+    Sp<Nc>::HotConfiguration(pRNG,SpUmu);
+
+    SpWilsonFermionD           SpDw (SpUmu,Grid,RBGrid,mass);
+    SpWilsonCompressedFermionD SpDwc(SpUmu,Grid,RBGrid,mass);
+
+    LatticeFermion result_c(&Grid);
+
+    SpDw.Dhop(src,result,0);
+    SpDwc.Dhop(src,result_c,0);
+
+    Grid.Barrier();
+    double ts0=usecond();
+    for(int i=0;i<ncall;i++){
+      SpDw.Dhop(src,result,0);
+    }
+    Grid.Barrier();
+    double ts1=usecond();
+    for(int i=0;i<ncall;i++){
+      SpDwc.Dhop(src,result_c,0);
+    }
+    Grid.Barrier();
+    double ts2=usecond();
+
+    // Nd Wilson in/out spinors plus 2*Nd links; compressed links are half size
+    double data_full = volume * ((2*Nd+1)*Nd*Nc + 2*Nd*Nc*Nc  ) * simdwidth / nsimd * ncall / (1024.*1024.*1024.);
+    double data_comp = volume * ((2*Nd+1)*Nd*Nc + 2*Nd*Nc*Nc/2) * simdwidth / nsimd * ncall / (1024.*1024.*1024.);
+    double sp_flops=single_site_flops*volume*ncall;
+
+    std::cout<<GridLogMessage << "Sp full links       mflop/s =   "<< sp_flops/(ts1-ts0)<<"  RF GiB/s (base 2) = "<< 1000000. * data_full/(ts1-ts0)<<std::endl;
+    std::cout<<GridLogMessage << "Sp compressed links mflop/s =   "<< sp_flops/(ts2-ts1)<<"  RF GiB/s (base 2) = "<< 1000000. * data_comp/(ts2-ts1)<<std::endl;
+    std::cout<<GridLogMessage << "Sp gauge field bytes saved per call = "<< volume*Nd*Nc*Nc*sizeof(Complex) <<std::endl;
+    std::cout<<GridLogMessage << "Sp compressed speedup = "<< (ts1-ts0)/(ts2-ts1) <<std::endl;
+
+    err = result-result_c;
+    std::cout<<GridLogMessage << "Sp norm diff full vs compressed   "<< norm2(err)<<std::endl;
+    assert(norm2(err) < 1.0e-10*norm2(result));
+  }
+#endif
+
   Grid_finalize();
 }
@@ -0,0 +1,122 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid
+
+    Source file: ./tests/Test_async_checkpoint.cc
+
+    Copyright (C) 2015
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+static std::string slurp(const std::string &file)
+{
+  std::ifstream fin(file, std::ios::binary);
+  std::stringstream ss;
+  ss << fin.rdbuf();
+  return ss.str();
+}
+
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  Coordinate simd_layout = GridDefaultSimd(4,vComplex::Nsimd());
+  Coordinate mpi_layout  = GridDefaultMpi();
+  Coordinate latt_size   = GridDefaultLatt();
+
+  GridCartesian Fine(latt_size,simd_layout,mpi_layout);
+
+  GridParallelRNG pRNGa(&Fine);
+  GridParallelRNG pRNGb(&Fine);
+  GridSerialRNG   sRNGa;
+  GridSerialRNG   sRNGb;
+  pRNGa.SeedFixedIntegers(std::vector<int>({45,12,81,9}));
+  sRNGa.SeedFixedIntegers(std::vector<int>({45,12,81,9}));
+  pRNGb.SeedFixedIntegers(std::vector<int>({1,2,3,4}));
+  sRNGb.SeedFixedIntegers(std::vector<int>({1,2,3,4}));
+
+  LatticeGaugeField Umu(&Fine);
+  LatticeGaugeField Uread(&Fine);
+  SU<Nc>::HotConfiguration(pRNGa,Umu);
+
+  NoSmearing<PeriodicGimplR> Config;
+  Config.set_Field(Umu);
+
+  CheckpointerParameters CPparams("ckpoint_async_lat","ckpoint_async_smr","ckpoint_async_rng",1,"IEEE64BIG");
+  AsyncBinaryHmcCheckpointer<PeriodicGimplR> Checkpoint(CPparams);
+
+  ////////////////////////////////////////////////
+  // Save, then clobber the field while the write is in flight
+  ////////////////////////////////////////////////
+  LatticeGaugeField Usave = Umu;
+  Checkpoint.TrajectoryComplete(10,Config,sRNGa,pRNGa);
+  SU<Nc>::HotConfiguration(pRNGb,Umu);
+  Checkpoint.WaitForCompletion();
+
+  ////////////////////////////////////////////////
+  // Reference files through the blocking path
+  ////////////////////////////////////////////////
+  typedef typename PeriodicGimplR::Field::vector_object vobj;
+  typedef typename vobj::scalar_object::DoublePrecision sobj_double;
+  BinarySimpleUnmunger<sobj_double, typename vobj::scalar_object> munge;
+  uint32_t nersc_csum, scidac_csuma, scidac_csumb;
+  std::string ref_lat("ckpoint_sync_lat.10");
+  std::string ref_rng("ckpoint_sync_rng.10");
+  if ( Fine.IsBoss() ) {
+    std::ofstream(ref_lat).close();
+    std::ofstream(ref_rng).close();
+  }
+  Fine.Barrier();
+  BinaryIO::writeRNG(sRNGa,pRNGa,ref_rng,0,nersc_csum,scidac_csuma,scidac_csumb);
+  BinaryIO::writeLatticeObject<vobj,sobj_double>(Usave,ref_lat,munge,0,"IEEE64BIG",
+						 nersc_csum,scidac_csuma,scidac_csumb);
+
+  if ( Fine.IsBoss() ) {
+    bool same_lat = slurp("ckpoint_async_lat.10") == slurp(ref_lat);
+    bool same_rng = slurp("ckpoint_async_rng.10") == slurp(ref_rng);
+    std::cout << GridLogMessage << "configuration file identical " << same_lat << std::endl;
+    std::cout << GridLogMessage << "RNG file identical           " << same_rng << std::endl;
+    assert(same_lat);
+    assert(same_rng);
+  }
+
+  ////////////////////////////////////////////////
+  // Restore and compare
+  ////////////////////////////////////////////////
+  Checkpoint.CheckpointRestore(10,Uread,sRNGb,pRNGb);
+  RealD diff = norm2(Uread-Usave);
+  std::cout << GridLogMessage << "restored configuration difference " << diff << std::endl;
+  assert(diff == 0.0);
+
+  LatticeComplex tmpa(&Fine); random(pRNGa,tmpa);
+  LatticeComplex tmpb(&Fine); random(pRNGb,tmpb);
+  ComplexD a,b;
+  random(sRNGa,a);
+  random(sRNGb,b);
+  RealD rdiff = norm2(tmpa-tmpb);
+  std::cout << GridLogMessage << "restored RNG difference " << rdiff << " serial " << a << " " << b << std::endl;
+  assert(rdiff == 0.0);
+  assert(a == b);
+
+  Grid_finalize();
+}
@@ -0,0 +1,129 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid
+
+    Source file: ./tests/IO/Test_binary_io_streamed.cc
+
+    Copyright (C) 2015
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+static std::string slurp(const std::string &file)
+{
+  std::ifstream fin(file, std::ios::binary);
+  std::stringstream ss;
+  ss << fin.rdbuf();
+  return ss.str();
+}
+
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  Coordinate simd_layout = GridDefaultSimd(4,vComplex::Nsimd());
+  Coordinate mpi_layout  = GridDefaultMpi();
+  Coordinate latt_size   = GridDefaultLatt();
+
+  GridCartesian Fine(latt_size,simd_layout,mpi_layout);
+
+  GridParallelRNG pRNG(&Fine);
+  pRNG.SeedFixedIntegers(std::vector<int>({45,12,81,9}));
+
+  LatticeGaugeField Umu(&Fine);
+  LatticeGaugeField Uread(&Fine);
+  SU<Nc>::HotConfiguration(pRNG,Umu);
+
+  typedef LatticeGaugeField::vector_object vobj;
+  typedef vobj::scalar_object sobj;
+  typedef sobj::DoublePrecision sobj_double;
+  BinarySimpleUnmunger<sobj_double, sobj> unmunge;
+  BinarySimpleMunger<sobj_double, sobj>   munge;
+
+  std::vector<std::string> formats({"IEEE64BIG","IEEE32"});
+  for(auto format : formats){
+    std::string ref_file("binary_io_ref.lat");
+    std::string str_file("binary_io_streamed.lat");
+    uint32_t nersc_ref, scidac_ref_a, scidac_ref_b;
+    uint32_t nersc_str, scidac_str_a, scidac_str_b;
+
+    ////////////////////////////////////////////////
+    // Whole-volume path as the reference
+    ////////////////////////////////////////////////
+    if ( Fine.IsBoss() ) std::ofstream(ref_file).close();
+    Fine.Barrier();
+    BinaryIO::latticeIoBufferBytes = 0;
+    BinaryIO::writeLatticeObject<vobj,sobj_double>(Umu,ref_file,unmunge,0,format,
+						   nersc_ref,scidac_ref_a,scidac_ref_b);
+
+    ////////////////////////////////////////////////
+    // Streamed through a buffer of a few x-runs, verified on write
+    ////////////////////////////////////////////////
+    BinaryIO::latticeIoBufferBytes = 3*latt_size[0]*sizeof(sobj_double)/mpi_layout[0]+1;
+    BinaryIO::latticeWriteMaxRetry = 0;
+    BinaryIO::writeLatticeObject<vobj,sobj_double>(Umu,str_file,unmunge,0,format,
+						   nersc_str,scidac_str_a,scidac_str_b);
+    BinaryIO::latticeWriteMaxRetry = -1;
+
+    std::cout << GridLogMessage << format << " checksums " << std::hex
+	      << nersc_ref << " " << scidac_ref_a << " " << scidac_ref_b << " / "
+	      << nersc_str << " " << scidac_str_a << " " << scidac_str_b << std::dec << std::endl;
+    assert(nersc_ref==nersc_str);
+    assert(scidac_ref_a==scidac_str_a);
+    assert(scidac_ref_b==scidac_str_b);
+    assert(BinaryIO::lastPerf.size == Fine.gSites()*sizeof(sobj_double));
+
+    if ( Fine.IsBoss() ) {
+      bool same = slurp(ref_file) == slurp(str_file);
+      std::cout << GridLogMessage << format << " streamed file identical " << same << std::endl;
+      assert(same);
+    }
+
+    ////////////////////////////////////////////////
+    // Streamed read back
+    ////////////////////////////////////////////////
+    BinaryIO::readLatticeObject<vobj,sobj_double>(Uread,ref_file,munge,0,format,
+						  nersc_str,scidac_str_a,scidac_str_b);
+    assert(nersc_ref==nersc_str);
+    assert(scidac_ref_a==scidac_str_a);
+    assert(scidac_ref_b==scidac_str_b);
+
+    RealD diff = norm2(Uread-Umu);
+    std::cout << GridLogMessage << format << " streamed read difference " << diff << std::endl;
+    if ( format == "IEEE64BIG" ) assert(diff == 0.0);
+    else                         assert(diff < 1.0e-10*norm2(Umu));
+  }
+
+  ////////////////////////////////////////////////
+  // Behind a header, through the NERSC reader and writer
+  ////////////////////////////////////////////////
+  BinaryIO::latticeIoBufferBytes = 1024;
+  FieldMetaData header;
+  NerscIO::writeConfiguration(Umu,"binary_io_streamed.nersc","streamed","streamed");
+  NerscIO::readConfiguration(Uread,header,"binary_io_streamed.nersc");
+  RealD diff = norm2(Uread-Umu);
+  std::cout << GridLogMessage << "NERSC streamed difference " << diff << std::endl;
+  assert(diff < 1.0e-10*norm2(Umu));
+  BinaryIO::latticeIoBufferBytes = 0;
+
+  Grid_finalize();
+}
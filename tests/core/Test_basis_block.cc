@@ -0,0 +1,100 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid
+
+    Source file: ./tests/core/Test_basis_block.cc
+
+    Copyright (C) 2015
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+// The blocked inner products, multi-axpy, CGS2 orthogonalisation and block
+// deflation against one vector at a time.
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  GridCartesian *grid = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(),GridDefaultSimd(Nd,vComplex::Nsimd()),GridDefaultMpi());
+
+  GridParallelRNG pRNG(grid);
+  pRNG.SeedFixedIntegers(std::vector<int>({1,2,3,4}));
+
+  // Not a multiple of the block size
+  const int N = 2*basisBlock+5;
+
+  std::vector<LatticeFermion> basis(N,grid);
+  std::vector<RealD> eval(N);
+  for(int i=0;i<N;i++){
+    gaussian(pRNG,basis[i]);
+    basisOrthogonalize(basis,basis[i],i);
+    basis[i] = basis[i]*(1.0/std::sqrt(norm2(basis[i])));
+    eval[i] = 0.1*(i+1);
+  }
+
+  RealD maxerr=0.0;
+  for(int i=0;i<N;i++){
+    for(int j=0;j<N;j++){
+      ComplexD ip = innerProduct(basis[i],basis[j]);
+      RealD err = abs(ip - ComplexD(i==j ? 1.0 : 0.0));
+      maxerr = std::max(maxerr,err);
+    }
+  }
+  std::cout << GridLogMessage << "max |<b_i,b_j> - delta_ij| = " << maxerr << std::endl;
+  assert(maxerr < 1.0e-12);
+
+  LatticeFermion src(grid), ref(grid), res(grid), diff(grid);
+  gaussian(pRNG,src);
+
+  std::vector<ComplexD> ip(N);
+  basisInnerProducts(ip,basis,0,N,src);
+  for(int j=0;j<N;j++){
+    assert(abs(ip[j]-innerProduct(basis[j],src)) < 1.0e-10*abs(ip[j]) + 1.0e-12);
+  }
+
+  // Deflation
+  ref = Zero();
+  for(int i=0;i<N;i++){
+    axpy(ref,TensorRemove(innerProduct(basis[i],src)) / eval[i],basis[i],ref);
+  }
+  DeflatedGuesser<LatticeFermion> Guesser(basis,eval);
+  Guesser(src,res);
+  diff = ref - res;
+  std::cout << GridLogMessage << "DeflatedGuesser |block - loop|^2 / |loop|^2 = " << norm2(diff)/norm2(ref) << std::endl;
+  assert(norm2(diff)/norm2(ref) < 1.0e-24);
+
+  basisDeflate(basis,eval,src,res);
+  diff = ref - res;
+  std::cout << GridLogMessage << "basisDeflate    |block - loop|^2 / |loop|^2 = " << norm2(diff)/norm2(ref) << std::endl;
+  assert(norm2(diff)/norm2(ref) < 1.0e-24);
+
+  // Orthogonalising src leaves nothing along the basis
+  basisOrthogonalize(basis,src,N);
+  basisInnerProducts(ip,basis,0,N,src);
+  RealD maxip=0.0;
+  for(int j=0;j<N;j++) maxip = std::max(maxip,abs(ip[j]));
+  std::cout << GridLogMessage << "max |<b_j,src>| after orthogonalisation = " << maxip << std::endl;
+  assert(maxip < 1.0e-12*std::sqrt(norm2(src)));
+
+  std::cout << GridLogMessage << "Done" <<std::endl;
+  Grid_finalize();
+}
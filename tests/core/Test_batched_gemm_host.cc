@@ -0,0 +1,140 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid
+
+    Source file: ./tests/Test_batched_gemm_host.cc
+
+    Copyright (C) 2024
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+#if !defined(GRID_SYCL) && !defined(GRID_CUDA) && !defined(GRID_HIP)
+
+// op(X)(i,l) of a column major matrix with leading dimension ld
+template<class scalar>
+scalar opElem(GridBLASOperation_t Op,const std::vector<scalar> &X,int ld,int i,int l)
+{
+  if ( Op==GridBLAS_OP_N ) return X[i + (int64_t)l*ld];
+  if ( Op==GridBLAS_OP_T ) return X[l + (int64_t)i*ld];
+  return conjugate(X[l + (int64_t)i*ld]);
+}
+
+template<class scalar> scalar randomElem(std::mt19937 &eng)
+{
+  std::uniform_real_distribution<double> uni(-1.0,1.0);
+  if constexpr (is_complex<scalar>::value) {
+    double re = uni(eng);
+    double im = uni(eng);
+    return scalar(re,im);
+  } else {
+    return scalar(uni(eng));
+  }
+}
+
+// gemmBatchedHost against a triple loop for all op(A) op(B) combinations.
+// The sizes are not multiples of the m, n and k blocking, so the edge tiles
+// are exercised; with beta zero C starts as NaN, which must never be read.
+template<class scalar>
+void checkGemmBatchedHost(std::string type,scalar alpha,scalar beta,double tol)
+{
+  const int m = 37;
+  const int n = 7;
+  const int k = 70;
+  const int batch = 3;
+  std::vector<GridBLASOperation_t> ops({GridBLAS_OP_N, GridBLAS_OP_T, GridBLAS_OP_C});
+  std::vector<std::string> opname({"N","T","C"});
+
+  std::mt19937 eng(1234);
+
+  for(int oa=0;oa<ops.size();oa++){
+  for(int ob=0;ob<ops.size();ob++){
+    GridBLASOperation_t OpA = ops[oa];
+    GridBLASOperation_t OpB = ops[ob];
+    int lda = (OpA==GridBLAS_OP_N) ? m : k;
+    int ldb = (OpB==GridBLAS_OP_N) ? k : n;
+    int ldc = m;
+
+    std::vector<std::vector<scalar> > A(batch,std::vector<scalar>(m*k));
+    std::vector<std::vector<scalar> > B(batch,std::vector<scalar>(k*n));
+    std::vector<std::vector<scalar> > C(batch,std::vector<scalar>(m*n));
+    std::vector<std::vector<scalar> > Cref(batch,std::vector<scalar>(m*n));
+    deviceVector<scalar *> Ap(batch), Bp(batch), Cp(batch);
+
+    for(int p=0;p<batch;p++){
+      for(auto &x : A[p]) x = randomElem<scalar>(eng);
+      for(auto &x : B[p]) x = randomElem<scalar>(eng);
+      for(int i=0;i<m*n;i++){
+	if ( beta==scalar(0.0) ) C[p][i] = scalar(std::nan(""));
+	else                     C[p][i] = randomElem<scalar>(eng);
+      }
+      for(int j=0;j<n;j++){
+	for(int i=0;i<m;i++){
+	  scalar acc = 0.0;
+	  for(int l=0;l<k;l++){
+	    acc += opElem(OpA,A[p],lda,i,l)*opElem(OpB,B[p],ldb,l,j);
+	  }
+	  Cref[p][i+j*ldc] = alpha*acc;
+	  if ( !(beta==scalar(0.0)) ) Cref[p][i+j*ldc] += beta*C[p][i+j*ldc];
+	}
+      }
+      Ap[p] = &A[p][0];
+      Bp[p] = &B[p][0];
+      Cp[p] = &C[p][0];
+    }
+
+    GridBLAS::gemmBatchedHost(OpA,OpB,m,n,k,alpha,Ap,Bp,beta,Cp);
+
+    double diff = 0.0;
+    double ref  = 0.0;
+    for(int p=0;p<batch;p++){
+      for(int i=0;i<m*n;i++){
+	diff += std::norm(C[p][i]-Cref[p][i]);
+	ref  += std::norm(Cref[p][i]);
+      }
+    }
+    std::cout << GridLogMessage << type << " op(A) " << opname[oa] << " op(B) " << opname[ob]
+	      << " |C - Cref|^2 / |Cref|^2 = " << diff/ref << std::endl;
+    assert(diff/ref < tol);
+  }}
+}
+
+#endif
+
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+#if !defined(GRID_SYCL) && !defined(GRID_CUDA) && !defined(GRID_HIP)
+  checkGemmBatchedHost<ComplexD>("ComplexD",ComplexD(0.5,-1.5),ComplexD(0.25,0.75),1.0e-26);
+  checkGemmBatchedHost<ComplexD>("ComplexD",ComplexD(1.0,0.0) ,ComplexD(0.0,0.0)  ,1.0e-26);
+  checkGemmBatchedHost<ComplexF>("ComplexF",ComplexF(0.5,-1.5),ComplexF(0.25,0.75),1.0e-10);
+  checkGemmBatchedHost<RealD>   ("RealD"   ,RealD(-1.25)      ,RealD(0.5)          ,1.0e-26);
+  checkGemmBatchedHost<RealD>   ("RealD"   ,RealD(2.0)        ,RealD(0.0)          ,1.0e-26);
+  checkGemmBatchedHost<RealF>   ("RealF"   ,RealF(-1.25)      ,RealF(0.5)          ,1.0e-10);
+#else
+  std::cout << GridLogMessage << "gemmBatchedHost is only built for host only targets" << std::endl;
+#endif
+
+  std::cout << GridLogMessage << "Done" << std::endl;
+  Grid_finalize();
+}
@@ -0,0 +1,89 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid
+
+    Source file: ./tests/core/Test_cshift_async.cc
+
+    Copyright (C) 2015
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace Grid;
+
+// All directions and both signs of one shift in a single exchange,
+// compared with the blocking Cshift
+template<class Field>
+RealD check_batched(const Field &U,int shift)
+{
+  GridBase *grid = U.Grid();
+  int Nd = grid->Nd();
+  std::vector<Field> fwd(Nd,grid), bwd(Nd,grid);
+
+  CshiftAsync<typename Field::vector_object> exchange;
+  for(int mu=0;mu<Nd;mu++){
+    exchange.Begin(fwd[mu],U,mu, shift);
+    exchange.Begin(bwd[mu],U,mu,-shift);
+  }
+  exchange.Complete();
+
+  RealD err=0.0;
+  for(int mu=0;mu<Nd;mu++){
+    Field ref_f = Cshift(U,mu, shift);
+    Field ref_b = Cshift(U,mu,-shift);
+    assert(fwd[mu].Checkerboard()==ref_f.Checkerboard());
+    assert(bwd[mu].Checkerboard()==ref_b.Checkerboard());
+    err += norm2(fwd[mu]-ref_f) + norm2(bwd[mu]-ref_b);
+  }
+  return err;
+}
+
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  Coordinate latt_size   = GridDefaultLatt();
+  int Nd = latt_size.size();
+  Coordinate simd_layout = GridDefaultSimd(Nd,vComplex::Nsimd());
+  Coordinate mpi_layout  = GridDefaultMpi();
+
+  GridCartesian         Fine  (latt_size,simd_layout,mpi_layout);
+  GridRedBlackCartesian RBFine(&Fine);
+
+  GridParallelRNG FineRNG(&Fine);  FineRNG.SeedFixedIntegers(std::vector<int>({45,12,81,9}));
+
+  LatticeComplex      C(&Fine);      random(FineRNG,C);
+  LatticeColourMatrix M(&Fine);      random(FineRNG,M);
+  LatticeColourMatrix Me(&RBFine);   pickCheckerboard(Even,Me,M);
+  LatticeColourMatrix Mo(&RBFine);   pickCheckerboard(Odd,Mo,M);
+
+  int maxshift = 0;
+  for(int d=0;d<Nd;d++) maxshift = std::max(maxshift,latt_size[d]);
+
+  for(int shift=0;shift<maxshift;shift++){
+    RealD err = check_batched(C,shift)
+              + check_batched(M,shift)
+              + check_batched(Me,shift)
+              + check_batched(Mo,shift);
+    std::cout<<GridLogMessage<<"Batched CshiftAsync by "<<shift<<" error "<<err<<std::endl;
+    assert(err==0.0);
+  }
+
+  Grid_finalize();
+}
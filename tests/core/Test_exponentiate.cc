@@ -0,0 +1,115 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid
+
+    Source file: ./tests/core/Test_exponentiate.cc
+
+    Copyright (C) 2015
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+// ExponentiateExact against a long Taylor series at small step, and its group
+// properties at steps large enough to need several squarings.
+template<class Group,class Field>
+void TestExponentiate(const std::string &name,GridParallelRNG &pRNG,Field &P)
+{
+  GridBase *grid = P.Grid();
+  Field U(grid), V(grid), W(grid), diff(grid);
+  Field unit(grid); unit = ComplexD(1.0,0.0);
+
+  Group::GaussianFundamentalLieAlgebraMatrix(pRNG,P);
+
+  std::cout << GridLogMessage << "===== "<<name<<" |P|^2 per site "<< norm2(P)/grid->gSites() <<std::endl;
+
+  for(RealD alpha : {0.01, 0.1}){
+    {
+      autoView(U_v,U,CpuWrite);
+      autoView(V_v,V,CpuWrite);
+      autoView(P_v,P,CpuRead);
+      thread_foreach(ss,P_v,{
+	U_v[ss] = ExponentiateExact(P_v[ss],alpha);
+	V_v[ss] = Exponentiate(P_v[ss],alpha,40);
+      });
+    }
+    diff = U - V;
+    std::cout << GridLogMessage << " alpha "<<alpha<<" |exact - taylor(40)|^2 / |taylor|^2 = "<< norm2(diff)/norm2(V) <<std::endl;
+    assert(norm2(diff)/norm2(V) < 1.0e-26);
+  }
+
+  for(RealD alpha : {1.0, 5.0, 20.0}){
+    {
+      autoView(U_v,U,CpuWrite);
+      autoView(V_v,V,CpuWrite);
+      autoView(W_v,W,CpuWrite);
+      autoView(P_v,P,CpuRead);
+      thread_foreach(ss,P_v,{
+	U_v[ss] = ExponentiateExact(P_v[ss],alpha);
+	V_v[ss] = ExponentiateExact(P_v[ss],0.5*alpha);
+	W_v[ss] = ExponentiateExact(P_v[ss],-alpha);
+      });
+    }
+    // exp(aP) = exp(aP/2)^2
+    diff = U - V*V;
+    RealD err_sq = norm2(diff)/norm2(U);
+    // exp(aP) exp(-aP) = 1
+    diff = U*W - unit;
+    RealD err_inv = norm2(diff)/norm2(unit);
+    // unitary
+    diff = adj(U)*U - unit;
+    RealD err_unit = norm2(diff)/norm2(unit);
+    // in the group: reprojection is the identity
+    diff = U - Group::ProjectOnGeneralGroup(U);
+    RealD err_grp = norm2(diff)/norm2(U);
+
+    std::cout << GridLogMessage << " alpha "<<alpha<<" square "<<err_sq<<" inverse "<<err_inv<<" unitarity "<<err_unit<<" group "<<err_grp<<std::endl;
+    assert(err_sq   < 1.0e-24);
+    assert(err_inv  < 1.0e-24);
+    assert(err_unit < 1.0e-24);
+    assert(err_grp  < 1.0e-24);
+  }
+}
+
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  GridCartesian *grid = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(),GridDefaultSimd(Nd,vComplex::Nsimd()),GridDefaultMpi());
+
+  GridParallelRNG pRNG(grid);
+  pRNG.SeedFixedIntegers(std::vector<int>({45,12,81,9}));
+
+  SU<Nc>::LatticeMatrix Psu(grid);
+  TestExponentiate<SU<Nc> >("SU("+std::to_string(Nc)+")",pRNG,Psu);
+
+  SU<4>::LatticeMatrix Psu4(grid);
+  TestExponentiate<SU<4> >("SU(4)",pRNG,Psu4);
+
+  Sp<4>::LatticeMatrix Psp4(grid);
+  TestExponentiate<Sp<4> >("Sp(4)",pRNG,Psp4);
+
+  Sp<6>::LatticeMatrix Psp6(grid);
+  TestExponentiate<Sp<6> >("Sp(6)",pRNG,Psp6);
+
+  std::cout << GridLogMessage << "Done" <<std::endl;
+  Grid_finalize();
+}
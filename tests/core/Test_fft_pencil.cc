@@ -0,0 +1,120 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid 
+
+    Source file: ./tests/core/Test_fft_pencil.cc
+
+    Copyright (C) 2015
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+// The distributed FFT against the same transform done by every rank on its
+// own copy of the whole lattice. Run on several ranks, e.g. --mpi 1.1.2.2,
+// to exercise the pencil transpose. Repeating a transform reuses the cached
+// plans on a different buffer and must give identical results.
+template<class Field>
+void Check(const std::string &name,GridCartesian *grid,GridCartesian *single,GridParallelRNG &pRNG)
+{
+  int nrank = grid->_Nprocessors;
+
+  Field src(grid), res(grid), again(grid);
+  gaussian(pRNG,src);
+
+  Field src_1(single), res_1(single);
+  Grid_split(src,src_1);
+  std::vector<Field> res_gathered(nrank,grid);
+
+  FFT theFFT(grid);
+  FFT theFFT_1(single);
+
+  for(int sign : {FFT::forward, FFT::backward}){
+    std::string dir = (sign==FFT::forward) ? "forward" : "backward";
+
+    // Each dimension on its own, then all at once
+    for(int dim=0;dim<=Nd;dim++){
+      if ( dim < Nd ) {
+	theFFT.FFT_dim(res,src,dim,sign);
+	theFFT_1.FFT_dim(res_1,src_1,dim,sign);
+      } else {
+	theFFT.FFT_all_dim(res,src,sign);
+	theFFT_1.FFT_all_dim(res_1,src_1,sign);
+      }
+      Grid_unsplit(res_gathered,res_1);
+
+      RealD nrm = norm2(res);
+      RealD err = 0.0;
+      for(int r=0;r<nrank;r++){
+	err = std::max(err,norm2(res - res_gathered[r])/nrm);
+      }
+
+      // Second call hits the plan cache with fresh buffers
+      again = Zero();
+      if ( dim < Nd ) theFFT.FFT_dim(again,src,dim,sign);
+      else            theFFT.FFT_all_dim(again,src,sign);
+      RealD rep = norm2(again - res);
+
+      std::cout << GridLogMessage << name << " " << dir << " dim " << dim
+		<< " distributed vs single rank " << err << " repeat " << rep << std::endl;
+      assert(err < 1.0e-24);
+      assert(rep <= 1.0e-28*nrm);
+    }
+  }
+
+  // Forward then backward is the identity
+  theFFT.FFT_all_dim(res,src,FFT::forward);
+  theFFT.FFT_all_dim(again,res,FFT::backward);
+  RealD roundtrip = norm2(again - src)/norm2(src);
+  std::cout << GridLogMessage << name << " round trip " << roundtrip << std::endl;
+  assert(roundtrip < 1.0e-24);
+}
+
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  Coordinate latt_size   = GridDefaultLatt();
+  Coordinate simd_layout = GridDefaultSimd(Nd,vComplexD::Nsimd());
+  Coordinate mpi_layout  = GridDefaultMpi();
+
+  GridCartesian *grid = SpaceTimeGrid::makeFourDimGrid(latt_size,simd_layout,mpi_layout);
+
+  // Every rank holds the whole lattice
+  Coordinate mpi_single(Nd,1);
+  int single_rank;
+  GridCartesian *single = new GridCartesian(latt_size,simd_layout,mpi_single,*grid,single_rank);
+
+  std::cout << GridLogMessage << "FFT on " << grid->_Nprocessors << " ranks against one" << std::endl;
+
+  GridParallelRNG pRNG(grid);
+  pRNG.SeedFixedIntegers(std::vector<int>({1,2,3,4}));
+
+  Check<LatticeComplexD>   ("LatticeComplexD"   ,grid,single,pRNG);
+  Check<LatticeFermionD>   ("LatticeFermionD"   ,grid,single,pRNG);
+  Check<LatticeSpinMatrixD>("LatticeSpinMatrixD",grid,single,pRNG);
+
+  FFT::ClearPlanCache();
+
+  delete single;
+  std::cout << GridLogMessage << "Done" <<std::endl;
+  Grid_finalize();
+}
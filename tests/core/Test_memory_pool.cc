@@ -0,0 +1,95 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid 
+
+    Source file: ./tests/Test_memory_pool.cc
+
+    Copyright (C) 2022
+
+Author: Peter Boyle <pboyle@bnl.gov>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+int main (int argc, char ** argv)
+{
+  // Pool freed host memory; this must be set before the first host allocation
+  MemoryManager::HostPoolMaxBytes = 256*1024*1024;
+
+  Grid_init(&argc,&argv);
+
+#ifdef GRID_UVM
+  // Unified memory keeps host allocations on the shared path; there is no pool to test
+  std::cout << GridLogMessage << "host pool is not available with unified memory"<<std::endl;
+  Grid_finalize();
+  return 0;
+#endif
+
+  GridCartesian         * UGrid   = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(), GridDefaultSimd(Nd,vComplex::Nsimd()),GridDefaultMpi());
+  GridRedBlackCartesian * UrbGrid = SpaceTimeGrid::makeFourDimRedBlackGrid(UGrid);
+
+  GridParallelRNG pRNG(UGrid);
+  pRNG.SeedFixedIntegers(std::vector<int>({45,12,81,9}));
+
+  LatticeColourMatrixD A(UGrid); random(pRNG,A);
+  LatticeColourMatrixD B(UGrid); random(pRNG,B);
+  LatticeColourMatrixD ref(UGrid);
+  ref = A*B + B*A - A;
+  RealD nref = norm2(ref);
+
+  MemoryStatus before = MemoryManager::GetFootprint();
+
+  // Temporaries of several sizes created and destroyed repeatedly
+  int N=100;
+  for(int i=0;i<N;i++){
+    LatticeColourMatrixD C(UGrid);
+    C = A*B + B*A - A;
+    LatticeColourMatrixD Ce(UrbGrid);
+    pickCheckerboard(Even,Ce,C);
+    LatticeComplexD tr(UGrid);
+    tr = trace(C);
+    LatticeColourMatrixD diff(UGrid);
+    diff = C - ref;
+    assert(norm2(diff) == 0.0);
+  }
+  assert(norm2(ref) == nref);
+
+  MemoryStatus after = MemoryManager::GetFootprint();
+  uint64_t hits   = after.HostPoolHits   - before.HostPoolHits;
+  uint64_t misses = after.HostPoolMisses - before.HostPoolMisses;
+
+  std::cout << GridLogMessage << "host pool hits "<<hits<<" misses "<<misses<<std::endl;
+  std::cout << GridLogMessage << "host pool free "<<after.HostPoolFreeBytes<<" bytes, rounding "<<after.HostPoolWasteBytes
+	    <<" bytes, peak "<<after.HostPoolHighWaterBytes<<" bytes"<<std::endl;
+  std::cout << GridLogMessage << "host peak "<<after.HostHighWaterBytes<<" bytes"<<std::endl;
+  MemoryManager::PrintBytes();
+
+  assert(after.HostHighWaterBytes >= after.HostBytes);
+  // Fails if the pool is off, e.g. overridden with --host-pool 0
+  assert(hits > 0);
+  // Every temporary after the first iteration is served from the free lists
+  assert(hits >= misses);
+  assert(after.HostPoolHighWaterBytes >= after.HostPoolFreeBytes);
+  assert(after.HostPoolFreeBytes <= MemoryManager::HostPoolMaxBytes);
+
+  Grid_finalize();
+}
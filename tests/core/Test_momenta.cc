@@ -0,0 +1,85 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid
+
+    Source file: ./tests/core/Test_momenta.cc
+
+    Copyright (C) 2015
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+// The single pass momentum generation against the per direction loop it
+// replaces: same momenta, and the RNG left in the same state.
+template<class Group,int N>
+void TestMomenta(const std::string &name,GridCartesian *grid)
+{
+  typedef typename Group::LatticeMatrix LinkField;
+  typedef Lattice<iVector<iScalar<iMatrix<vComplex,N> >,Nd> > Field;
+
+  std::vector<int> seeds({1,2,3,4});
+  GridParallelRNG pRNG_fused(grid); pRNG_fused.SeedFixedIntegers(seeds);
+  GridParallelRNG pRNG_loop (grid); pRNG_loop .SeedFixedIntegers(seeds);
+
+  RealD scale = ::sqrt(HMC_MOMENTUM_DENOMINATOR);
+
+  Field P(grid), Pref(grid), diff(grid);
+  double t0=usecond();
+  Group::GaussianFundamentalLieAlgebraMatrix(pRNG_fused, P, 1.0, scale);
+  double t1=usecond();
+
+  LinkField Pmu(grid);
+  for(int mu=0;mu<Nd;mu++){
+    Group::GaussianFundamentalLieAlgebraMatrix(pRNG_loop, Pmu);
+    Pmu = Pmu*scale;
+    PokeIndex<LorentzIndex>(Pref, Pmu, mu);
+  }
+  double t2=usecond();
+
+  diff = P - Pref;
+  std::cout << GridLogMessage << name << " |fused - loop|^2 / |loop|^2 = " << norm2(diff)/norm2(Pref)
+	    << "  fused " << (t1-t0)/1000 << " ms, loop " << (t2-t1)/1000 << " ms" << std::endl;
+  assert(norm2(diff)/norm2(Pref) < 1.0e-28);
+
+  // Both streams must continue identically
+  LatticeReal r_fused(grid), r_loop(grid), r_diff(grid);
+  gaussian(pRNG_fused, r_fused);
+  gaussian(pRNG_loop,  r_loop);
+  r_diff = r_fused - r_loop;
+  std::cout << GridLogMessage << name << " next draw difference " << norm2(r_diff) << std::endl;
+  assert(norm2(r_diff) == 0.0);
+}
+
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  GridCartesian *grid = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(),GridDefaultSimd(Nd,vComplex::Nsimd()),GridDefaultMpi());
+
+  TestMomenta<SU<Nc>,Nc>("SU("+std::to_string(Nc)+")",grid);
+  TestMomenta<SU<4>,4>("SU(4)",grid);
+  TestMomenta<Sp<4>,4>("Sp(4)",grid);
+  TestMomenta<Sp<6>,6>("Sp(6)",grid);
+
+  std::cout << GridLogMessage << "Done" <<std::endl;
+  Grid_finalize();
+}
@@ -0,0 +1,92 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid
+
+    Source file: ./tests/core/Test_reduction_queue.cc
+
+    Copyright (C) 2015
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+// Deferred reductions, blocking and non-blocking, against the immediate
+// innerProduct, norm2, sum and sliceSum.
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  GridCartesian *grid = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(),GridDefaultSimd(Nd,vComplex::Nsimd()),GridDefaultMpi());
+
+  GridParallelRNG pRNG(grid);
+  pRNG.SeedFixedIntegers(std::vector<int>({1,2,3,4}));
+
+  LatticeFermion x(grid), y(grid);
+  LatticeComplex c(grid);
+  gaussian(pRNG,x);
+  gaussian(pRNG,y);
+  gaussian(pRNG,c);
+
+  ComplexD xy_ref = innerProduct(x,y);
+  RealD    xx_ref = norm2(x);
+  RealD    yy_ref = norm2(y);
+  auto     cs_ref = sum(c);
+  std::vector<LatticeComplex::scalar_object> ct_ref;
+  sliceSum(c,ct_ref,Nd-1);
+
+  for(int nonblocking=0;nonblocking<2;nonblocking++){
+    ReductionQueue q(grid);
+    auto xy = q.innerProduct(x,y);
+    auto xx = q.norm2(x);
+    auto cs = q.sum(c);
+    auto ct = q.sliceSum(c,Nd-1);
+    auto yy = q.norm2(y);
+    if ( nonblocking ) q.Begin();
+
+    std::vector<LatticeComplex::scalar_object> ct_v;
+    ct.get(ct_v);
+    ComplexD cs_v = TensorRemove(cs.get());
+
+    std::cout << GridLogMessage << (nonblocking ? "non-blocking" : "blocking")
+	      << " <x,y> " << xy.get() << " ref " << xy_ref
+	      << " |x|^2 " << xx.get() << " ref " << xx_ref << std::endl;
+    assert(q.Reduced());
+    assert(abs(xy.get()-xy_ref) < 1.0e-10*abs(xy_ref));
+    assert(fabs(xx.get()-xx_ref) < 1.0e-10*xx_ref);
+    assert(fabs(yy.get()-yy_ref) < 1.0e-10*yy_ref);
+    assert(abs(cs_v-ComplexD(TensorRemove(cs_ref))) < 1.0e-5*abs(cs_v));
+
+    assert(ct_v.size() == ct_ref.size());
+    for(int t=0;t<ct_v.size();t++){
+      ComplexD a = TensorRemove(ct_v[t]);
+      ComplexD b = TensorRemove(ct_ref[t]);
+      assert(abs(a-b) < 1.0e-5*(abs(b)+1.0));
+    }
+
+    // Queue is reusable after a reset
+    q.Reset();
+    auto yy2 = q.norm2(y);
+    assert(fabs(yy2.get()-yy_ref) < 1.0e-10*yy_ref);
+  }
+
+  std::cout << GridLogMessage << "Done" <<std::endl;
+  Grid_finalize();
+}
@@ -0,0 +1,117 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid 
+
+    Source file: ./tests/forces/Test_wilson_force_chrono.cc
+
+    Copyright (C) 2015
+
+Author: Peter Boyle <paboyle@ph.ed.ac.uk>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+typedef TwoFlavourEvenOddPseudoFermionAction<WilsonImplD> Action_t;
+
+// Force solves along a short MD-like path; returns the CG iterations and
+// keeps the forces for comparison
+int ForcePath(Action_t &Action, ConjugateGradient<LatticeFermionD> &CG,
+	      const LatticeGaugeField &U0, const LatticeGaugeField &P,
+	      int steps, RealD ep, std::vector<LatticeGaugeField> &forces)
+{
+  GridBase *grid = U0.Grid();
+  LatticeGaugeField U(grid);
+  LatticeGaugeField Pcopy(grid);
+  U = U0;
+  int iters = 0;
+  for(int s=0;s<steps;s++){
+    Action.deriv(U,forces[s]);
+    iters += CG.IterationsToComplete;
+    Pcopy = P;
+    PeriodicGimplD::update_field(Pcopy,U,ep);
+  }
+  return iters;
+}
+
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  Coordinate latt_size   = GridDefaultLatt();
+  Coordinate simd_layout = GridDefaultSimd(Nd,vComplex::Nsimd());
+  Coordinate mpi_layout  = GridDefaultMpi();
+
+  GridCartesian               Grid(latt_size,simd_layout,mpi_layout);
+  GridRedBlackCartesian     RBGrid(&Grid);
+
+  GridSerialRNG            sRNG; sRNG.SeedFixedIntegers(std::vector<int>({4,3,2,1}));
+  GridParallelRNG          pRNG(&Grid);
+  pRNG.SeedFixedIntegers(std::vector<int>({1,2,3,4}));
+
+  LatticeGaugeField U(&Grid);
+  LatticeGaugeField P(&Grid);
+  SU<Nc>::TepidConfiguration(pRNG,U);
+  PeriodicGimplD::generate_momenta(P,sRNG,pRNG);
+
+  RealD mass=0.1;
+  WilsonFermionD Dw(U,Grid,RBGrid,mass);
+
+  ConjugateGradient<LatticeFermionD> CG(1.0e-10,10000);
+  Action_t Action(Dw,CG,CG);
+
+  const int steps = 8;
+  const RealD ep  = 0.02;
+  std::vector<LatticeGaugeField> plain(steps,&Grid);
+  std::vector<LatticeGaugeField> chrono(steps,&Grid);
+
+  GridParallelRNG pRNGpf(&Grid);
+  pRNGpf.SeedFixedIntegers(std::vector<int>({5,6,7,8}));
+  Action.refresh(U,sRNG,pRNGpf);
+  int iters_plain = ForcePath(Action,CG,U,P,steps,ep,plain);
+
+  // Same pseudofermion; refresh clears the history
+  Action.setChronoForecastDegree(4);
+  pRNGpf.SeedFixedIntegers(std::vector<int>({5,6,7,8}));
+  Action.refresh(U,sRNG,pRNGpf);
+  int iters_chrono = ForcePath(Action,CG,U,P,steps,ep,chrono);
+
+  RealD maxdiff = 0.0;
+  for(int s=0;s<steps;s++){
+    RealD diff = std::sqrt(norm2(chrono[s]-plain[s])/norm2(plain[s]));
+    maxdiff = std::max(maxdiff,diff);
+  }
+  std::cout << GridLogMessage << "Force CG iterations: zero guess " << iters_plain
+	    << " chronological guess " << iters_chrono << std::endl;
+  std::cout << GridLogMessage << "Largest relative force difference " << maxdiff << std::endl;
+
+  assert(iters_chrono < iters_plain);
+  assert(maxdiff < 1.0e-6);
+
+  // A second pass after refresh reproduces the first forecast sequence
+  pRNGpf.SeedFixedIntegers(std::vector<int>({5,6,7,8}));
+  Action.refresh(U,sRNG,pRNGpf);
+  int iters_again = ForcePath(Action,CG,U,P,steps,ep,plain);
+  std::cout << GridLogMessage << "Force CG iterations after refresh " << iters_again << std::endl;
+  assert(iters_again == iters_chrono);
+
+  Grid_finalize();
+}
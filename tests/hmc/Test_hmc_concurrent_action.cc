@@ -0,0 +1,210 @@
+/*************************************************************************************
+
+Grid physics library, www.github.com/paboyle/Grid
+
+Source file: ./tests/hmc/Test_hmc_concurrent_action.cc
+
+Copyright (C) 2015
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+See the full license in the file "LICENSE" in the top level distribution
+directory
+*************************************************************************************/
+/*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace Grid;
+
+typedef ConcurrentAction<LatticeGaugeField> Concurrent_t;
+typedef Action<LatticeGaugeField> *ActPtr;
+
+// The concurrent action value and force against the unsplit evaluation of
+// the same actions, one per subgroup. The unsplit actions are refreshed
+// with the seeds the concurrent refresh hands each subgroup.
+void Compare(const std::string &name, GridCartesian *UGrid, Concurrent_t &Concurrent,
+	     std::vector<ActPtr> &reference, const LatticeGaugeField &U,
+	     RealD S_tol, RealD F_tol)
+{
+  int nsplit = reference.size();
+
+  GridSerialRNG   sRNG;
+  GridParallelRNG pRNG(UGrid);
+  sRNG.SeedFixedIntegers(std::vector<int>({1,2,3,4}));
+  pRNG.SeedFixedIntegers(std::vector<int>({11,12,13,14}));
+  Concurrent.refresh(U, sRNG, pRNG);
+
+  GridSerialRNG sRNG_ref;
+  sRNG_ref.SeedFixedIntegers(std::vector<int>({1,2,3,4}));
+  std::vector<int> seeds = Concurrent_t::RefreshSeeds(sRNG_ref);
+  for(int s=0;s<nsplit;s++){
+    GridSerialRNG   sRNG_s;
+    GridParallelRNG pRNG_s(UGrid);
+    sRNG_s.SeedFixedIntegers(seeds);
+    Concurrent_t::SeedSubgroup(pRNG_s, seeds, s);
+    reference[s]->refresh(U, sRNG_s, pRNG_s);
+  }
+
+  RealD S_ref = 0.0;
+  LatticeGaugeField F_ref(UGrid); F_ref = Zero();
+  LatticeGaugeField tmp(UGrid);
+  for(int s=0;s<nsplit;s++){
+    S_ref += reference[s]->S(U);
+    reference[s]->deriv(U, tmp);
+    F_ref = F_ref + tmp;
+  }
+
+  RealD S = Concurrent.S(U);
+  LatticeGaugeField F(UGrid);
+  Concurrent.deriv(U, F);
+
+  RealD S_err = std::fabs(S - S_ref) / std::fabs(S_ref);
+  RealD F_err = norm2(F - F_ref) / norm2(F_ref);
+  std::cout << GridLogMessage << name << " S " << S << " reference " << S_ref << " relative error " << S_err << std::endl;
+  std::cout << GridLogMessage << name << " force relative error " << F_err << std::endl;
+  assert(S_err < S_tol);
+  assert(F_err < F_tol);
+
+  // Every rank must have drawn the same serial numbers
+  RealD r; random(sRNG, r);
+  RealD r0 = r; UGrid->Broadcast(0, (void *)&r0, sizeof(r0));
+  assert(r == r0);
+}
+
+// Run on several ranks, e.g. --mpi 1.1.2.2; by default the last
+// non-trivial processor dimension is halved to make two subgroups
+int main(int argc, char **argv)
+{
+  Grid_init(&argc, &argv);
+
+  Coordinate mpi_layout = GridDefaultMpi();
+  Coordinate mpi_split  = mpi_layout;
+  for(int d=Nd-1;d>=0;d--){
+    if ( mpi_split[d] % 2 == 0 ) { mpi_split[d] /= 2; break; }
+  }
+
+  GridCartesian *UGrid = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(),
+							 GridDefaultSimd(Nd, vComplex::Nsimd()),
+							 mpi_layout);
+  GridRedBlackCartesian *UrbGrid = SpaceTimeGrid::makeFourDimRedBlackGrid(UGrid);
+  int split_rank;
+  GridCartesian *SGrid = new GridCartesian(GridDefaultLatt(),
+					   GridDefaultSimd(Nd, vComplex::Nsimd()),
+					   mpi_split, *UGrid, split_rank);
+  GridRedBlackCartesian *SrbGrid = SpaceTimeGrid::makeFourDimRedBlackGrid(SGrid);
+  int nsplit = UGrid->_Nprocessors / SGrid->_Nprocessors;
+  std::cout << GridLogMessage << "Concurrent actions on " << nsplit << " subgroups" << std::endl;
+
+  GridParallelRNG pRNG(UGrid);
+  pRNG.SeedFixedIntegers(std::vector<int>({21,22,23,24}));
+  LatticeGaugeField U(UGrid);
+  SU<Nc>::HotConfiguration(pRNG, U);
+
+  LatticeGaugeField Ucold(SGrid);
+  SU<Nc>::ColdConfiguration(Ucold);
+  LatticeGaugeField Ucold_full(UGrid);
+  SU<Nc>::ColdConfiguration(Ucold_full);
+
+  // One action per subgroup, and the same set on the full grid for reference
+  std::vector<RealD> betas, masses;
+  for(int s=0;s<nsplit;s++){
+    betas.push_back(1.0+0.5*s);
+    masses.push_back(0.2+0.1*s);
+  }
+
+  ConjugateGradient<LatticeFermionD>        CG(1.0e-12, 10000);
+  ConjugateGradient<WilsonAdjFermionD::FermionField> CGadj(1.0e-12, 10000);
+
+  ////////////////////////////////////
+  // Gauge actions
+  ////////////////////////////////////
+  {
+    std::vector<IwasakiGaugeActionR *> iwasaki;
+    std::vector<ActPtr> reference;
+    for(int s=0;s<nsplit;s++){
+      iwasaki.push_back(new IwasakiGaugeActionR(betas[s]));
+      reference.push_back(iwasaki[s]);
+    }
+
+    IwasakiGaugeActionR mine(betas[split_rank]);
+    Concurrent_t Concurrent(UGrid, SGrid, split_rank, {&mine});
+    std::cout << Concurrent.LogParameters();
+
+    Compare("Iwasaki", UGrid, Concurrent, reference, U, 1.0e-12, 1.0e-24);
+    for(auto a : iwasaki) delete a;
+  }
+
+  ////////////////////////////////////
+  // Two flavour pseudofermions, drawn on the split grids
+  ////////////////////////////////////
+  {
+    typedef TwoFlavourPseudoFermionAction<WilsonImplD> Nf2_t;
+    std::vector<WilsonFermionD *> ops;
+    std::vector<Nf2_t *> nf2;
+    std::vector<ActPtr> reference;
+    for(int s=0;s<nsplit;s++){
+      ops.push_back(new WilsonFermionD(Ucold_full, *UGrid, *UrbGrid, masses[s]));
+      nf2.push_back(new Nf2_t(*ops[s], CG, CG));
+      reference.push_back(nf2[s]);
+    }
+
+    WilsonFermionD FermOp(Ucold, *SGrid, *SrbGrid, masses[split_rank]);
+    Nf2_t mine(FermOp, CG, CG);
+    Concurrent_t Concurrent(UGrid, SGrid, split_rank, {&mine});
+    std::cout << Concurrent.LogParameters();
+
+    Compare("TwoFlavour", UGrid, Concurrent, reference, U, 1.0e-9, 1.0e-18);
+    for(auto a : nf2) delete a;
+    for(auto o : ops) delete o;
+  }
+
+  ////////////////////////////////////
+  // Adjoint two flavour pseudofermions through RepresentationAction
+  ////////////////////////////////////
+  {
+    typedef TwoFlavourPseudoFermionAction<WilsonAdjImplD> Nf2_t;
+    typedef RepresentationAction<AdjointRepresentation>   Rep_t;
+    AdjointRepresentation Radj_full(UGrid);
+    Radj_full.update_representation(Ucold_full);
+    std::vector<WilsonAdjFermionD *> ops;
+    std::vector<Nf2_t *> nf2;
+    std::vector<Rep_t *> rep;
+    std::vector<ActPtr> reference;
+    for(int s=0;s<nsplit;s++){
+      ops.push_back(new WilsonAdjFermionD(Radj_full.U, *UGrid, *UrbGrid, masses[s]));
+      nf2.push_back(new Nf2_t(*ops[s], CGadj, CGadj));
+      rep.push_back(new Rep_t(UGrid, *nf2[s]));
+      reference.push_back(rep[s]);
+    }
+
+    AdjointRepresentation Radj(SGrid);
+    Radj.update_representation(Ucold);
+    WilsonAdjFermionD FermOp(Radj.U, *SGrid, *SrbGrid, masses[split_rank]);
+    Nf2_t nf2_mine(FermOp, CGadj, CGadj);
+    Rep_t mine(SGrid, nf2_mine);
+    Concurrent_t Concurrent(UGrid, SGrid, split_rank, {&mine});
+    std::cout << Concurrent.LogParameters();
+
+    Compare("Adjoint TwoFlavour", UGrid, Concurrent, reference, U, 1.0e-9, 1.0e-18);
+    for(auto a : rep) delete a;
+    for(auto a : nf2) delete a;
+    for(auto o : ops) delete o;
+  }
+
+  delete SrbGrid;
+  delete SGrid;
+  std::cout << GridLogMessage << "Done" << std::endl;
+  Grid_finalize();
+}
@@ -0,0 +1,117 @@
+/*************************************************************************************
+
+Grid physics library, www.github.com/paboyle/Grid
+
+Source file: ./tests/hmc/Test_hmc_force_diagnostics.cc
+
+Copyright (C) 2015
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+See the full license in the file "LICENSE" in the top level distribution
+directory
+*************************************************************************************/
+/*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace Grid;
+
+typedef PeriodicGimplR            Gimpl;
+typedef NoSmearing<Gimpl>         Smearing;
+typedef Gimpl::Field              Field;
+typedef Representations<FundamentalRepresentation> Repr;
+typedef LeapFrog<Gimpl, Smearing> Integ;
+
+int main(int argc, char **argv)
+{
+  Grid_init(&argc, &argv);
+
+  GridCartesian *grid = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(),
+							GridDefaultSimd(Nd, vComplex::Nsimd()),
+							GridDefaultMpi());
+  GridParallelRNG pRNG(grid);
+  pRNG.SeedFixedIntegers(std::vector<int>({11,12,13,14}));
+  Field U(grid);
+  SU<Nc>::HotConfiguration(pRNG, U);
+
+  // Two actions on the level so that the level total differs from both
+  WilsonGaugeActionR Waction_a(1.0);
+  WilsonGaugeActionR Waction_b(2.5);
+  ActionLevel<Field> Level1(1);
+  Level1.push_back(&Waction_a);
+  Level1.push_back(&Waction_b);
+  ActionSet<Field, Repr> Aset;
+  Aset.push_back(Level1);
+
+  ////////////////////////////////////////////////
+  // Reference forces and statistics
+  ////////////////////////////////////////////////
+  RealD ep = 0.1;
+  RealD coeff = ep * HMC_MOMENTUM_DENOMINATOR;
+  Field Fa(grid), Fb(grid);
+  Waction_a.deriv(U, Fa); Fa = Gimpl::projectForce(Fa);
+  Waction_b.deriv(U, Fb); Fb = Gimpl::projectForce(Fb);
+  Field Ftot = Fa + Fb;
+
+  std::vector<RealD> ref_abs({std::sqrt(norm2(Fa)/grid->gSites()),
+			      std::sqrt(norm2(Fb)/grid->gSites()),
+			      std::sqrt(norm2(Ftot)/grid->gSites())});
+  std::vector<RealD> ref_max({std::sqrt(maxLocalNorm2(Fa)),
+			      std::sqrt(maxLocalNorm2(Fb)),
+			      std::sqrt(maxLocalNorm2(Ftot))});
+
+  Smearing Smear;
+  Smear.set_Field(U);
+  Field Mom_ref(grid); Mom_ref = Zero();
+  Mom_ref = Mom_ref - Ftot*coeff;
+
+  for(int every : std::vector<int>({1, 0, 2})) {
+    IntegratorParameters MD(1, 1.0);
+    Integ MDyn(grid, MD, Aset, Smear);
+    MDyn.setForceDiagnostics(every);
+    MDyn.reset_timer();
+
+    Field Mom(grid);
+    int calls = 3;
+    for(int c=0;c<calls;c++){
+      Mom = Zero();
+      MDyn.update_P(Mom, U, 0, ep);
+    }
+    RealD mom_err = norm2(Mom - Mom_ref) / norm2(Mom_ref);
+
+    std::vector<Action<Field> *> stats({&Waction_a, &Waction_b, MDyn.LevelForces[0].actions.at(0)});
+    int expect = every ? (calls + every - 1) / every : 0;
+
+    std::cout << GridLogMessage << "ForceDiagnostics " << every << " momentum error " << mom_err << std::endl;
+    assert(mom_err < 1.0e-28);
+    for(int s=0;s<stats.size();s++){
+      std::cout << GridLogMessage << "  [" << s << "] calls " << stats[s]->deriv_calls
+		<< " samples " << stats[s]->deriv_num;
+      assert(stats[s]->deriv_calls == calls);
+      assert(stats[s]->deriv_num == expect);
+      if ( expect ) {
+	RealD err_abs = std::fabs(stats[s]->deriv_norm_average() - ref_abs[s]) / ref_abs[s];
+	RealD err_max = std::fabs(stats[s]->deriv_max_average()  - ref_max[s]) / ref_max[s];
+	std::cout << " force average " << stats[s]->deriv_norm_average() << " ref " << ref_abs[s]
+		  << " force max " << stats[s]->deriv_max_average() << " ref " << ref_max[s];
+	assert(err_abs < 1.0e-12);
+	assert(err_max < 1.0e-12);
+      }
+      std::cout << std::endl;
+    }
+  }
+
+  Grid_finalize();
+}
@@ -0,0 +1,116 @@
+/*************************************************************************************
+
+Grid physics library, www.github.com/paboyle/Grid
+
+Source file: ./tests/hmc/Test_hmc_integrator_order.cc
+
+Copyright (C) 2015
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+See the full license in the file "LICENSE" in the top level distribution
+directory
+*************************************************************************************/
+/*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace Grid;
+
+typedef PeriodicGimplR            Gimpl;
+typedef NoSmearing<Gimpl>         Smearing;
+typedef Gimpl::Field              Field;
+typedef Representations<FundamentalRepresentation> Repr;
+
+// |dH| of one trajectory from fixed U and momenta
+template <class Integrator>
+RealD deltaH(GridCartesian *grid, const Field &U0, ActionSet<Field, Repr> &Aset, int MDsteps)
+{
+  Smearing Smear;
+  Field U(grid);
+  U = U0;
+  Smear.set_Field(U);
+
+  IntegratorParameters MD(MDsteps, 1.0);
+  Integrator MDyn(grid, MD, Aset, Smear);
+
+  GridSerialRNG   sRNG;  sRNG.SeedFixedIntegers(std::vector<int>({1,2,3,4}));
+  GridParallelRNG pRNG(grid); pRNG.SeedFixedIntegers(std::vector<int>({5,6,7,8}));
+  MDyn.refresh(U, sRNG, pRNG);
+  RealD H0 = MDyn.Sinitial(U);
+  MDyn.integrate(U);
+  RealD H1 = MDyn.S(U);
+  return std::fabs(H1 - H0);
+}
+
+template <class Integrator>
+RealD order(const std::string &name, GridCartesian *grid, const Field &U, ActionSet<Field, Repr> &Aset)
+{
+  RealD dH1 = deltaH<Integrator>(grid, U, Aset, 10);
+  RealD dH2 = deltaH<Integrator>(grid, U, Aset, 20);
+  RealD p   = std::log2(dH1 / dH2) / 2.0;
+  std::cout << GridLogMessage << name << " |dH| " << dH1 << " -> " << dH2
+	    << " : dH ~ dt^" << 2.0 * p << std::endl;
+  return p;
+}
+
+int main(int argc, char **argv)
+{
+  Grid_init(&argc, &argv);
+
+  GridCartesian *grid = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(),
+							GridDefaultSimd(Nd, vComplex::Nsimd()),
+							GridDefaultMpi());
+  GridParallelRNG pRNG(grid);
+  pRNG.SeedFixedIntegers(std::vector<int>({11,12,13,14}));
+  Field U(grid);
+  SU<Nc>::TepidConfiguration(pRNG, U);
+
+  // Split the gauge action over two levels to exercise the nesting
+  WilsonGaugeActionR Waction_outer(1.0);
+  WilsonGaugeActionR Waction_inner(1.0);
+  ActionLevel<Field> Level1(1);
+  ActionLevel<Field> Level2(2);
+  Level1.push_back(&Waction_outer);
+  Level2.push_back(&Waction_inner);
+  ActionSet<Field, Repr> Aset;
+  Aset.push_back(Level1);
+  Aset.push_back(Level2);
+
+  RealD pMN2  = order<MinimumNorm2<Gimpl, Smearing> >           ("MinimumNorm2           ", grid, U, Aset);
+  RealD pFG   = order<ForceGradient<Gimpl, Smearing> >          ("ForceGradient          ", grid, U, Aset);
+  RealD pFV   = order<MinimumNorm4FV<Gimpl, Smearing> >         ("MinimumNorm4FV         ", grid, U, Aset);
+  RealD pFP   = order<MinimumNorm4FP<Gimpl, Smearing> >         ("MinimumNorm4FP         ", grid, U, Aset);
+
+  // Force gradient on both levels is fourth order overall
+  {
+    Smearing Smear;
+    IntegratorParameters MD(4, 1.0);
+    ForceGradientMultiLevel<Gimpl, Smearing> probe(grid, MD, Aset, Smear);
+    assert(probe.ForceGradientLevels == std::vector<int>({0}));
+  }
+  struct FGBoth : public ForceGradientMultiLevel<Gimpl, Smearing> {
+    FGBoth(GridBase *g, IntegratorParameters P, ActionSet<Field, Repr> &A, Smearing &S)
+      : ForceGradientMultiLevel<Gimpl, Smearing>(g, P, A, S) { this->setForceGradientLevels({0,1}); }
+  };
+  RealD pFGML = order<FGBoth>("ForceGradientMultiLevel", grid, U, Aset);
+
+  assert(pMN2  > 0.8 && pMN2 < 1.2);
+  assert(pFG   > 1.7);
+  assert(pFV   > 1.7);
+  assert(pFP   > 1.7);
+  assert(pFGML > 1.7);
+
+  Grid_finalize();
+}
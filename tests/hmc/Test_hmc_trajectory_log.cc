@@ -0,0 +1,111 @@
+/*************************************************************************************
+
+Grid physics library, www.github.com/paboyle/Grid
+
+Source file: ./tests/hmc/Test_hmc_trajectory_log.cc
+
+Copyright (C) 2015
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+See the full license in the file "LICENSE" in the top level distribution
+directory
+*************************************************************************************/
+/*  END LEGAL */
+#include <Grid/Grid.h>
+
+int main(int argc, char **argv) 
+{
+  using namespace Grid;
+
+  Grid_init(&argc, &argv);
+  GridLogLayout();
+
+  typedef GenericHMCRunner<MinimumNorm2> HMCWrapper;
+  typedef WilsonImplD FermionImplPolicy;
+  typedef WilsonFermionD FermionAction;
+  typedef typename FermionAction::FermionField FermionField;
+
+  HMCWrapper TheHMC;
+  TheHMC.Resources.AddFourDimGrid("gauge");
+
+  CheckpointerParameters CPparams;  
+  CPparams.config_prefix = "ckpoint_log_lat";
+  CPparams.rng_prefix = "ckpoint_log_rng";
+  CPparams.saveInterval = 1;
+  CPparams.format = "IEEE64BIG";
+  TheHMC.Resources.LoadNerscCheckpointer(CPparams);
+
+  RNGModuleParameters RNGpar;
+  RNGpar.serial_seeds = "1 2 3 4 5";
+  RNGpar.parallel_seeds = "6 7 8 9 10";
+  TheHMC.Resources.SetRNGSeeds(RNGpar);
+
+  auto GridPtr   = TheHMC.Resources.GetCartesian();
+  auto GridRBPtr = TheHMC.Resources.GetRBCartesian();
+
+  // Gauge action on the inner level, two flavours of Wilson on the outer
+  WilsonGaugeActionR Waction(5.6);
+  LatticeGaugeField U(GridPtr);
+  FermionAction FermOp(U, *GridPtr, *GridRBPtr, 0.2);
+  ConjugateGradient<FermionField> CG(1.0e-8, 2000);
+  TwoFlavourEvenOddPseudoFermionAction<FermionImplPolicy> Nf2(FermOp, CG, CG);
+
+  ActionLevel<HMCWrapper::Field> Level1(1);
+  ActionLevel<HMCWrapper::Field> Level2(2);
+  Level1.push_back(&Nf2);
+  Level2.push_back(&Waction);
+  TheHMC.TheAction.push_back(Level1);
+  TheHMC.TheAction.push_back(Level2);
+
+  TheHMC.Parameters.MD.MDsteps = 4;
+  TheHMC.Parameters.MD.trajL   = 1.0;
+  TheHMC.Parameters.StartingType = "ColdStart";
+  TheHMC.Parameters.Trajectories = 2;
+  TheHMC.Parameters.NoMetropolisUntil = 0;
+
+  TheHMC.ReadCommandLine(argc, argv);
+  if ( TheHMC.TrajectoryLog.empty() ) TheHMC.TrajectoryLog = "trajectory_log.jsonl";
+  if ( GridPtr->IsBoss() ) std::remove(TheHMC.TrajectoryLog.c_str());
+  GridPtr->Barrier();
+
+  TheHMC.Run();
+
+  ///////////////////////////////////////////////
+  // One well formed record per trajectory
+  ///////////////////////////////////////////////
+  if ( GridPtr->IsBoss() ) {
+    std::ifstream fin(TheHMC.TrajectoryLog);
+    std::string line;
+    int records = 0;
+    while ( std::getline(fin, line) ) {
+      json record = json::parse(line);
+      std::cout << GridLogMessage << record.dump(2) << std::endl;
+      assert(record["trajectory"].get<int>() == records);
+      assert(std::fabs(record["dH"].get<double>() - (record["H1"].get<double>() - record["H0"].get<double>())) < 1.0e-6);
+      assert(record.count("plaquette"));
+      assert(record["actions"].size() == 2);
+      assert(record["actions"][0]["force_calls"].get<int>() > 0);
+      assert(record["actions"][0]["force_iter"].get<uint64_t>() > 0);
+      assert(record["solver"]["iterations"].get<uint64_t>() >=
+	     record["actions"][0]["force_iter"].get<uint64_t>());
+      assert(record["dslash"]["full"].get<uint64_t>() > 0);
+      records++;
+    }
+    assert(records == 2);
+  }
+
+  Grid_finalize();
+} // main
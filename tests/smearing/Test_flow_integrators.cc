@@ -0,0 +1,90 @@
+/*************************************************************************************
+
+Grid physics library, www.github.com/paboyle/Grid
+
+Source file: ./tests/smearing/Test_flow_integrators.cc
+
+Copyright (C) 2017
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+See the full license in the file "LICENSE" in the top level distribution
+directory
+*************************************************************************************/
+/*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace Grid;
+
+typedef PeriodicGimplR Gimpl;
+
+// Step size convergence of the RK3 and CF4 integrators for the Wilson,
+// Symanzik and Zeuthen flows, and the adaptive CF4 against a fine fixed step.
+template <class Flow>
+RealD FlowError(const LatticeGaugeField &U, const LatticeGaugeField &ref, RealD tau, RealD eps, FlowAction action)
+{
+  LatticeGaugeField V(U.Grid());
+  Flow WF(eps, (int)std::lround(tau/eps), 1, action);
+  WF.resetActions();
+  WF.smear(V, U);
+  return WilsonFlowBase<Gimpl>::flowDistance(V, ref);
+}
+
+int main(int argc, char **argv)
+{
+  Grid_init(&argc, &argv);
+
+  GridCartesian *grid = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(), GridDefaultSimd(Nd, vComplex::Nsimd()), GridDefaultMpi());
+
+  GridParallelRNG pRNG(grid);
+  pRNG.SeedFixedIntegers(std::vector<int>({1, 2, 3, 4, 5}));
+
+  LatticeGaugeField U(grid), ref(grid);
+  SU<Nc>::TepidConfiguration(pRNG, U);
+
+  RealD tau = 0.4;
+  std::vector<std::pair<FlowAction, std::string> > actions = {
+    {FlowAction::Wilson, "Wilson"}, {FlowAction::Symanzik, "Symanzik"}, {FlowAction::Zeuthen, "Zeuthen"}};
+
+  for (auto const &a : actions) {
+    WilsonFlowCF4<Gimpl> Fine(0.0125, 32, 1, a.first);
+    Fine.resetActions();
+    Fine.smear(ref, U);
+
+    RealD rk3_1 = FlowError<WilsonFlow<Gimpl> >(U, ref, tau, 0.1, a.first);
+    RealD rk3_2 = FlowError<WilsonFlow<Gimpl> >(U, ref, tau, 0.05, a.first);
+    RealD cf4_1 = FlowError<WilsonFlowCF4<Gimpl> >(U, ref, tau, 0.1, a.first);
+    RealD cf4_2 = FlowError<WilsonFlowCF4<Gimpl> >(U, ref, tau, 0.05, a.first);
+
+    std::cout << GridLogMessage << a.second << " flow RK3 error " << rk3_1 << " -> " << rk3_2 << " ratio " << rk3_1/rk3_2 << std::endl;
+    std::cout << GridLogMessage << a.second << " flow CF4 error " << cf4_1 << " -> " << cf4_2 << " ratio " << cf4_1/cf4_2 << std::endl;
+    // Global orders three and four; the fine reference limits the last ratio
+    assert(rk3_1/rk3_2 > 6.0);
+    assert(cf4_1/cf4_2 > 12.0);
+    assert(cf4_1 < rk3_1);
+
+    RealD tolerance = 1.0e-5;
+    WilsonFlowCF4Adaptive<Gimpl> Adaptive(0.05, tau, tolerance, 1, a.first);
+    Adaptive.resetActions();
+    LatticeGaugeField V(grid);
+    Adaptive.smear(V, U);
+    RealD err = WilsonFlowBase<Gimpl>::flowDistance(V, ref);
+    std::cout << GridLogMessage << a.second << " flow adaptive CF4 error " << err << std::endl;
+    assert(err < 10.0 * tolerance);
+  }
+
+  std::cout << GridLogMessage << "Done" << std::endl;
+  Grid_finalize();
+}
@@ -0,0 +1,117 @@
+/*************************************************************************************
+
+Grid physics library, www.github.com/paboyle/Grid
+
+Source file: ./tests/smearing/Test_flow_observables.cc
+
+Copyright (C) 2017
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+See the full license in the file "LICENSE" in the top level distribution
+directory
+*************************************************************************************/
+/*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace Grid;
+
+// The single pass flow observables against the separate plaquette, cloverleaf
+// and topological charge measurements, on a hot and a lightly flowed field.
+int main(int argc, char **argv)
+{
+  Grid_init(&argc, &argv);
+
+  GridCartesian *grid = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(), GridDefaultSimd(Nd, vComplex::Nsimd()), GridDefaultMpi());
+
+  GridParallelRNG pRNG(grid);
+  pRNG.SeedFixedIntegers(std::vector<int>({1, 2, 3, 4, 5}));
+
+  LatticeGaugeField U(grid), V(grid);
+  SU<Nc>::HotConfiguration(pRNG, U);
+
+  WilsonFlow<PeriodicGimplR> WF(0.02, 5, 1);
+  WF.resetActions();
+  WF.smear(V, U);
+
+  WilsonLoops<PeriodicGimplR>::CloverObservablesWorkspace wk;
+
+  for (auto field : {&U, &V}) {
+    RealD t = 0.1;
+    RealD Eplaq, Eclov, Q;
+    WilsonFlowBase<PeriodicGimplR>::flowObservables(t, *field, Eplaq, Eclov, Q, wk);
+
+    RealD Eplaq_ref = WilsonFlowBase<PeriodicGimplR>::energyDensityPlaquette(t, *field);
+    RealD Eclov_ref = WilsonFlowBase<PeriodicGimplR>::energyDensityCloverleaf(t, *field);
+    RealD Q_ref     = WilsonLoops<PeriodicGimplR>::TopologicalCharge(*field);
+
+    std::cout << GridLogMessage << "E_plaq " << Eplaq << " ref " << Eplaq_ref << std::endl;
+    std::cout << GridLogMessage << "E_clov " << Eclov << " ref " << Eclov_ref << std::endl;
+    std::cout << GridLogMessage << "Q      " << Q     << " ref " << Q_ref     << std::endl;
+    assert(fabs(Eplaq - Eplaq_ref) < 1.0e-6 * fabs(Eplaq_ref));
+    assert(fabs(Eclov - Eclov_ref) < 1.0e-6 * fabs(Eclov_ref));
+    assert(fabs(Q - Q_ref) < 1.0e-6 * (fabs(Q_ref) + 1.0));
+
+    // Per timeslice: the charge against the 1x1 MxN charge, and the energies
+    // against sliceSums of the separately built plaquettes and field strengths
+    typedef WilsonLoops<PeriodicGimplR> WL;
+    typedef PeriodicGimplR::GaugeLinkField GaugeMat;
+    std::vector<RealD> Eplaq_t, Eclov_t, Q_t;
+    WilsonFlowBase<PeriodicGimplR>::timesliceFlowObservables(t, *field, Eplaq_t, Eclov_t, Q_t, wk);
+    std::vector<Real> Q_t_ref = WL::TimesliceTopologicalChargeMxN(*field, 1, 1);
+
+    std::vector<GaugeMat> Umu(Nd, grid);
+    for (int mu = 0; mu < Nd; mu++) Umu[mu] = PeekIndex<LorentzIndex>(*field, mu);
+    LatticeComplex plaq(grid);
+    WL::sitePlaquette(plaq, Umu);
+
+    GaugeMat F(grid);
+    LatticeComplex FF(grid);
+    FF = Zero();
+    for (int mu = 0; mu < Nd-1; mu++) {
+      for (int nu = mu+1; nu < Nd; nu++) {
+	WL::FieldStrength(F, *field, mu, nu);
+	FF = FF + trace(F*F);
+      }
+    }
+    std::vector<LatticeComplex::scalar_object> plaq_t, FF_t;
+    sliceSum(plaq, plaq_t, Nd-1);
+    sliceSum(FF, FF_t, Nd-1);
+
+    size_t Nt = Q_t_ref.size();
+    assert(Q_t.size() == Nt && Eplaq_t.size() == Nt && Eclov_t.size() == Nt);
+    RealD faces = (1.0 * Nd * (Nd - 1)) / 2.0;
+    RealD vol_t = grid->gSites() / RealD(Nt);
+    RealD Q_sum = 0.0;
+    for (int tt = 0; tt < (int)Nt; tt++) {
+      RealD p = real(TensorRemove(plaq_t[tt])) / vol_t / faces / Nc;
+      RealD Eplaq_t_ref = 2.0 * t * t * 3.0 * (1.0 - p) * faces;
+      RealD Eclov_t_ref = -t * t * real(TensorRemove(FF_t[tt])) / vol_t;
+
+      std::cout << GridLogMessage << " t " << tt
+		<< " E_plaq " << Eplaq_t[tt] << " ref " << Eplaq_t_ref
+		<< " E_clov " << Eclov_t[tt] << " ref " << Eclov_t_ref
+		<< " Q " << Q_t[tt] << " ref " << Q_t_ref[tt] << std::endl;
+      assert(fabs(Eplaq_t[tt] - Eplaq_t_ref) < 1.0e-6 * fabs(Eplaq_t_ref));
+      assert(fabs(Eclov_t[tt] - Eclov_t_ref) < 1.0e-6 * fabs(Eclov_t_ref));
+      assert(fabs(Q_t[tt] - Q_t_ref[tt]) < 1.0e-6 * (fabs(Q_t_ref[tt]) + 1.0));
+      Q_sum += Q_t[tt];
+    }
+    assert(fabs(Q_sum - Q) < 1.0e-8 * (fabs(Q) + 1.0));
+  }
+
+  std::cout << GridLogMessage << "Done" << std::endl;
+  Grid_finalize();
+}
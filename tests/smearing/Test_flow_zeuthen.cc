@@ -0,0 +1,100 @@
+/*************************************************************************************
+
+Grid physics library, www.github.com/paboyle/Grid
+
+Source file: ./tests/smearing/Test_flow_zeuthen.cc
+
+Copyright (C) 2017
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+See the full license in the file "LICENSE" in the top level distribution
+directory
+*************************************************************************************/
+/*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace Grid;
+
+typedef PeriodicGaugeImpl<GaugeImplTypes<vComplexD, 4, 12, Sp<4> > > Sp4Gimpl;
+
+// (1 + 1/12 D*_mu D_mu) Z_mu written out with Cshifts, independently of the
+// CovShift form used by the flow
+template <class Gimpl>
+void ZeuthenReference(typename Gimpl::GaugeField &Z, const typename Gimpl::GaugeField &U)
+{
+  typedef typename Gimpl::GaugeLinkField GaugeMat;
+  for (int mu = 0; mu < Nd; mu++) {
+    GaugeMat Umu  = PeekIndex<LorentzIndex>(U, mu);
+    GaugeMat Zmu  = PeekIndex<LorentzIndex>(Z, mu);
+    GaugeMat Zfwd = Cshift(Zmu, mu, 1);
+    GaugeMat Zbwd = Cshift(Zmu, mu, -1);
+    GaugeMat Ubwd = Cshift(Umu, mu, -1);
+    GaugeMat lap  = Umu*Zfwd*adj(Umu) + adj(Ubwd)*Zbwd*Ubwd - 2.0*Zmu;
+    Zmu = Zmu + (1.0/12.0)*lap;
+    PokeIndex<LorentzIndex>(Z, Zmu, mu);
+  }
+}
+
+// The Zeuthen correction on a random algebra field, and the Zeuthen flow
+// force against the corrected Symanzik force
+template <class Gimpl, class Group>
+void Check(const std::string &name, GridCartesian *grid, GridParallelRNG &pRNG)
+{
+  typedef typename Gimpl::GaugeField GaugeField;
+
+  GaugeField U(grid), Z(grid), Zref(grid);
+  Group::HotConfiguration(pRNG, U);
+
+  Group::GaussianFundamentalLieAlgebraMatrix(pRNG, Z);
+  Zref = Z;
+  WilsonFlowBase<Gimpl>::zeuthenCorrection(Z, U);
+  ZeuthenReference<Gimpl>(Zref, U);
+  RealD err = norm2(Z - Zref) / norm2(Zref);
+  std::cout << GridLogMessage << name << " correction of a random algebra field, relative error " << err << std::endl;
+  assert(err < 1.0e-28);
+
+  SymanzikGaugeAction<Gimpl> SS(3.0);
+  SS.deriv(U, Zref);
+  ZeuthenReference<Gimpl>(Zref, U);
+  WilsonFlow<Gimpl> WF(0.01, 1, 1, FlowAction::Zeuthen);
+  WF.flowForce(Z, U);
+  err = norm2(Z - Zref) / norm2(Zref);
+  std::cout << GridLogMessage << name << " Zeuthen flow force, relative error " << err << std::endl;
+  assert(err < 1.0e-28);
+
+  // The correction is not trivial on a hot field
+  GaugeField Zs(grid);
+  SS.deriv(U, Zs);
+  RealD diff = norm2(Z - Zs) / norm2(Zs);
+  std::cout << GridLogMessage << name << " Zeuthen vs Symanzik force, relative difference " << diff << std::endl;
+  assert(diff > 1.0e-6);
+}
+
+int main(int argc, char **argv)
+{
+  Grid_init(&argc, &argv);
+
+  GridCartesian *grid = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(), GridDefaultSimd(Nd, vComplexD::Nsimd()), GridDefaultMpi());
+
+  GridParallelRNG pRNG(grid);
+  pRNG.SeedFixedIntegers(std::vector<int>({1, 2, 3, 4, 5}));
+
+  Check<PeriodicGimplD, SU<Nc> >("SU(" + std::to_string(Nc) + ")", grid, pRNG);
+  Check<Sp4Gimpl, Sp<4> >("Sp(4)", grid, pRNG);
+
+  std::cout << GridLogMessage << "Done" << std::endl;
+  Grid_finalize();
+}
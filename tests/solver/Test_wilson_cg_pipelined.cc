@@ -0,0 +1,83 @@
+    /*************************************************************************************
+
+    Grid physics library, www.github.com/paboyle/Grid 
+
+    Source file: ./tests/Test_wilson_cg_pipelined.cc
+
+    Copyright (C) 2015
+
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+    See the full license in the file "LICENSE" in the top level distribution directory
+    *************************************************************************************/
+    /*  END LEGAL */
+#include <Grid/Grid.h>
+
+using namespace std;
+using namespace Grid;
+
+int main (int argc, char ** argv)
+{
+  Grid_init(&argc,&argv);
+
+  Coordinate latt_size   = GridDefaultLatt();
+  Coordinate simd_layout = GridDefaultSimd(Nd,vComplex::Nsimd());
+  Coordinate mpi_layout  = GridDefaultMpi();
+  GridCartesian               Grid(latt_size,simd_layout,mpi_layout);
+  GridRedBlackCartesian     RBGrid(&Grid);
+
+  std::vector<int> seeds({1,2,3,4});
+  GridParallelRNG          pRNG(&Grid);  pRNG.SeedFixedIntegers(seeds);
+
+  LatticeFermion src(&Grid); random(pRNG,src);
+  LatticeFermion result(&Grid); result=Zero();
+  LatticeFermion result_pipe(&Grid); result_pipe=Zero();
+  LatticeGaugeField Umu(&Grid); SU<Nc>::HotConfiguration(pRNG,Umu);
+
+  RealD mass=0.5;
+  WilsonFermionD Dw(Umu,Grid,RBGrid,mass);
+
+  MdagMLinearOperator<WilsonFermionD,LatticeFermion> HermOp(Dw);
+  ConjugateGradient<LatticeFermion> CG(1.0e-8,10000);
+  CG(HermOp,src,result);
+
+  ConjugateGradientPipelined<LatticeFermion> PipeCG(1.0e-8,10000);
+  PipeCG(HermOp,src,result_pipe);
+
+  std::cout << GridLogMessage << "CG iterations " << CG.IterationsToComplete
+	    << " pipelined CG iterations " << PipeCG.IterationsToComplete << std::endl;
+  std::cout << GridLogMessage << "CG true residual " << CG.TrueResidual
+	    << " pipelined CG true residual " << PipeCG.TrueResidual << std::endl;
+
+  LatticeFermion diff(&Grid);
+  diff = result - result_pipe;
+  RealD err = std::sqrt(norm2(diff)/norm2(result));
+  std::cout << GridLogMessage << "|result - result_pipe|/|result| " << err << std::endl;
+  assert(PipeCG.TrueResidual < 1.0e-7);
+  assert(err < 1.0e-6);
+
+  // Red-black operator exercises the checkerboarded fields
+  LatticeFermion src_o(&RBGrid);
+  LatticeFermion result_o(&RBGrid);
+  pickCheckerboard(Odd,src_o,src);
+  result_o=Zero();
+  SchurDiagMooeeOperator<WilsonFermionD,LatticeFermion> HermOpEO(Dw);
+  ConjugateGradientPipelined<LatticeFermion> PipeCGEO(1.0e-8,10000,true,50);
+  PipeCGEO(HermOpEO,src_o,result_o);
+  assert(PipeCGEO.TrueResidual < 1.0e-7);
+
+  Grid_finalize();
+}
@@ -0,0 +1,43 @@
+#include <Grid/Grid.h>
+
+using namespace Grid;
+
+template <class Rep, class Group>
+static void check_update_representation(GridCartesian *grid, GridParallelRNG &pRNG) {
+  LatticeGaugeField Umu(grid);
+  Group::HotConfiguration(pRNG, Umu);
+
+  Rep Kernel(grid);
+  Rep Reference(grid);
+  Kernel.update_representation(Umu);
+  Reference.update_representation_reference(Umu);
+
+  typename Rep::LatticeField diff(grid);
+  diff = Kernel.U - Reference.U;
+  RealD err = norm2(diff) / norm2(Reference.U);
+  std::cout << GridLogMessage << "Dimension " << Rep::Dimension
+            << " |U_kernel - U_reference|^2 / |U_reference|^2 = " << err << std::endl;
+  assert(err < 1e-12);
+}
+
+int main(int argc, char** argv) {
+  Grid_init(&argc, &argv);
+
+  Coordinate latt_size = GridDefaultLatt();
+  Coordinate simd_layout = GridDefaultSimd(Nd, vComplex::Nsimd());
+  Coordinate mpi_layout = GridDefaultMpi();
+
+  GridCartesian Grid(latt_size, simd_layout, mpi_layout);
+  GridParallelRNG pRNG(&Grid);
+  pRNG.SeedFixedIntegers(std::vector<int>({1, 2, 3, 4}));
+
+  std::cout << GridLogMessage << "Checking the site kernel for the two-index links of Sp(" << Nc << ")" << std::endl;
+  check_update_representation<SpTwoIndexSymmetricRepresentation, Sp<Nc> >(&Grid, pRNG);
+  check_update_representation<SpTwoIndexAntiSymmetricRepresentation, Sp<Nc> >(&Grid, pRNG);
+
+  std::cout << GridLogMessage << "Checking the site kernel for the two-index links of SU(" << Nc << ")" << std::endl;
+  check_update_representation<TwoIndexSymmetricRepresentation, SU<Nc> >(&Grid, pRNG);
+  check_update_representation<TwoIndexAntiSymmetricRepresentation, SU<Nc> >(&Grid, pRNG);
+
+  Grid_finalize();
+}
@@ -0,0 +1,124 @@
+#include <Grid/Grid.h>
+
+using namespace Grid;
+
+// Compact against dense clover for the Sp(2N) two-index antisymmetric
+// representation, and a finite difference check of the compact clover force.
+int main(int argc, char **argv)
+{
+  Grid_init(&argc, &argv);
+
+  typedef SpWilsonTwoIndexAntiSymmetricImplD FermionImplPolicy;
+  typedef FermionImplPolicy::FermionField    FermionField;
+  typedef FermionImplPolicy::GaugeField      RepGaugeField;
+  typedef FermionImplPolicy::GaugeLinkField  RepLinkField;
+  const int Dimension = FermionImplPolicy::Dimension;
+
+  GridCartesian         *UGrid   = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(), GridDefaultSimd(Nd, vComplex::Nsimd()), GridDefaultMpi());
+  GridRedBlackCartesian *UrbGrid = SpaceTimeGrid::makeFourDimRedBlackGrid(UGrid);
+
+  GridParallelRNG pRNG(UGrid);
+  pRNG.SeedFixedIntegers(std::vector<int>({1, 2, 30, 50}));
+
+  LatticeGaugeField U(UGrid);
+  Sp<Nc>::HotConfiguration(pRNG, U);
+
+  SpTwoIndexAntiSymmetricRepresentation R(UGrid);
+  R.update_representation(U);
+
+  std::cout << GridLogMessage << "Sp(" << Nc << ") 2AS clover, representation dimension " << Dimension << std::endl;
+
+  RealD mass = 0.1;
+  RealD csw  = 1.0;
+  SpWilsonCloverTwoIndexAntiSymmetricFermionD        Dense(R.U, *UGrid, *UrbGrid, mass, csw, csw);
+  SpCompactWilsonCloverTwoIndexAntiSymmetricFermionD Compact(R.U, *UGrid, *UrbGrid, mass, csw, csw);
+
+  FermionField phi(UGrid); gaussian(pRNG, phi);
+  FermionField chi(UGrid); gaussian(pRNG, chi);
+  FermionField ref(UGrid), res(UGrid), diff(UGrid);
+
+  ////////////////////////////////////
+  // Operator and clover inverse
+  ////////////////////////////////////
+  Dense.M(phi, ref);
+  Compact.M(phi, res);
+  diff = ref - res;
+  std::cout << GridLogMessage << "M      |dense - compact|^2 / |dense|^2 = " << norm2(diff) / norm2(ref) << std::endl;
+  assert(norm2(diff) / norm2(ref) < 1.0e-24);
+
+  FermionField phi_e(UrbGrid), ref_e(UrbGrid), res_e(UrbGrid), diff_e(UrbGrid);
+  pickCheckerboard(Even, phi_e, phi);
+  Dense.MooeeInv(phi_e, ref_e);
+  Compact.MooeeInv(phi_e, res_e);
+  diff_e = ref_e - res_e;
+  std::cout << GridLogMessage << "MooeeInv |dense - compact|^2 / |dense|^2 = " << norm2(diff_e) / norm2(ref_e) << std::endl;
+  assert(norm2(diff_e) / norm2(ref_e) < 1.0e-24);
+
+  Compact.Mooee(res_e, ref_e);
+  diff_e = ref_e - phi_e;
+  std::cout << GridLogMessage << "Mooee MooeeInv - 1 = " << norm2(diff_e) / norm2(phi_e) << std::endl;
+  assert(norm2(diff_e) / norm2(phi_e) < 1.0e-24);
+
+  ////////////////////////////////////
+  // Force against the dense operator
+  ////////////////////////////////////
+  FermionField Mphi(UGrid);
+  Compact.M(phi, Mphi);
+  ComplexD S = innerProduct(Mphi, Mphi);
+
+  RepGaugeField UdSdU(UGrid), UdSdU_dense(UGrid), tmp(UGrid);
+  Compact.MDeriv(tmp, Mphi, phi, DaggerNo);  UdSdU = tmp;
+  Compact.MDeriv(tmp, phi, Mphi, DaggerYes); UdSdU += tmp;
+  Dense.MDeriv(tmp, Mphi, phi, DaggerNo);    UdSdU_dense = tmp;
+  Dense.MDeriv(tmp, phi, Mphi, DaggerYes);   UdSdU_dense += tmp;
+  tmp = UdSdU - UdSdU_dense;
+  std::cout << GridLogMessage << "MDeriv |dense - compact|^2 / |dense|^2 = " << norm2(tmp) / norm2(UdSdU_dense) << std::endl;
+  assert(norm2(tmp) / norm2(UdSdU_dense) < 1.0e-24);
+
+  ////////////////////////////////////
+  // Finite difference in the representation links
+  ////////////////////////////////////
+  RealD dt = 0.0001;
+  RepLinkField mommu(UGrid), forcemu(UGrid);
+  RepGaugeField mom(UGrid), Uprime(UGrid);
+  for (int mu = 0; mu < Nd; mu++) {
+    SU<Dimension>::GaussianFundamentalLieAlgebraMatrix(pRNG, mommu);
+    PokeIndex<LorentzIndex>(mom, mommu, mu);
+  }
+  {
+    autoView(Uprime_v, Uprime, CpuWrite);
+    autoView(U_v, R.U, CpuRead);
+    autoView(mom_v, mom, CpuRead);
+    thread_foreach(ss, mom_v, {
+      for (int mu = 0; mu < Nd; mu++) {
+        Uprime_v[ss]._internal[mu] = Exponentiate(mom_v[ss]._internal[mu], dt, 12) * U_v[ss]._internal[mu];
+      }
+    });
+  }
+
+  Compact.ImportGauge(Uprime);
+  FermionField MphiPrime(UGrid);
+  Compact.M(phi, MphiPrime);
+  ComplexD Sprime = innerProduct(MphiPrime, MphiPrime);
+
+  LatticeComplex dS(UGrid);
+  dS = Zero();
+  for (int mu = 0; mu < Nd; mu++) {
+    forcemu = PeekIndex<LorentzIndex>(UdSdU, mu);
+    forcemu = Ta(forcemu) * 2.0;
+    mommu   = PeekIndex<LorentzIndex>(mom, mu);
+    dS = dS + trace(mommu * forcemu) * dt;
+  }
+  ComplexD dSpred = sum(dS);
+
+  std::cout << GridLogMessage << " S      " << S << std::endl;
+  std::cout << GridLogMessage << " Sprime " << Sprime << std::endl;
+  std::cout << GridLogMessage << "dS (S' - S)          :" << Sprime - S << std::endl;
+  std::cout << GridLogMessage << "predict dS (force)   :" << dSpred << std::endl;
+  RealD err = fabs(real(Sprime - S - dSpred)) / fabs(real(Sprime - S));
+  std::cout << GridLogMessage << "relative error " << err << std::endl;
+  assert(err < 1.0e-2);
+
+  std::cout << GridLogMessage << "Done" << std::endl;
+  Grid_finalize();
+}
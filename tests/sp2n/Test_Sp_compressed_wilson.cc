@@ -0,0 +1,76 @@
+#include <Grid/Grid.h>
+
+using namespace Grid;
+
+// Compressed link storage against the full Sp(2N) Wilson operator on a hot
+// configuration, with antiperiodic boundary conditions in time.
+int main(int argc, char **argv)
+{
+  Grid_init(&argc, &argv);
+
+  typedef SpWilsonImplD::FermionField FermionField;
+
+  GridCartesian         *UGrid   = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(), GridDefaultSimd(Nd, vComplex::Nsimd()), GridDefaultMpi());
+  GridRedBlackCartesian *UrbGrid = SpaceTimeGrid::makeFourDimRedBlackGrid(UGrid);
+
+  GridParallelRNG pRNG(UGrid);
+  pRNG.SeedFixedIntegers(std::vector<int>({1, 2, 30, 50}));
+
+  LatticeGaugeField U(UGrid);
+  Sp<Nc>::HotConfiguration(pRNG, U);
+
+  std::cout << GridLogMessage << "Sp(" << Nc << ") compressed Wilson" << std::endl;
+
+  std::vector<Complex> boundary_phases(Nd, 1.0);
+  boundary_phases[Nd - 1] = -1.0;
+  SpWilsonImplD::ImplParams Params(boundary_phases);
+  SpWilsonCompressedImplD::ImplParams CParams(boundary_phases);
+
+  RealD mass = 0.1;
+  SpWilsonFermionD           Full(U, *UGrid, *UrbGrid, mass, Params);
+  SpWilsonCompressedFermionD Compressed(U, *UGrid, *UrbGrid, mass, CParams);
+
+  FermionField phi(UGrid); gaussian(pRNG, phi);
+  FermionField ref(UGrid), res(UGrid), diff(UGrid);
+
+  ////////////////////////////////////
+  // Full lattice operators
+  ////////////////////////////////////
+  Full.Dhop(phi, ref, DaggerNo);
+  Compressed.Dhop(phi, res, DaggerNo);
+  diff = ref - res;
+  std::cout << GridLogMessage << "Dhop    |full - compressed|^2 / |full|^2 = " << norm2(diff) / norm2(ref) << std::endl;
+  assert(norm2(diff) / norm2(ref) < 1.0e-24);
+
+  Full.Dhop(phi, ref, DaggerYes);
+  Compressed.Dhop(phi, res, DaggerYes);
+  diff = ref - res;
+  std::cout << GridLogMessage << "Dhopdag |full - compressed|^2 / |full|^2 = " << norm2(diff) / norm2(ref) << std::endl;
+  assert(norm2(diff) / norm2(ref) < 1.0e-24);
+
+  Full.M(phi, ref);
+  Compressed.M(phi, res);
+  diff = ref - res;
+  std::cout << GridLogMessage << "M       |full - compressed|^2 / |full|^2 = " << norm2(diff) / norm2(ref) << std::endl;
+  assert(norm2(diff) / norm2(ref) < 1.0e-24);
+
+  Full.Mdag(phi, ref);
+  Compressed.Mdag(phi, res);
+  diff = ref - res;
+  std::cout << GridLogMessage << "Mdag    |full - compressed|^2 / |full|^2 = " << norm2(diff) / norm2(ref) << std::endl;
+  assert(norm2(diff) / norm2(ref) < 1.0e-24);
+
+  ////////////////////////////////////
+  // Checkerboarded hopping term
+  ////////////////////////////////////
+  FermionField phi_e(UrbGrid), ref_o(UrbGrid), res_o(UrbGrid), diff_o(UrbGrid);
+  pickCheckerboard(Even, phi_e, phi);
+  Full.Meooe(phi_e, ref_o);
+  Compressed.Meooe(phi_e, res_o);
+  diff_o = ref_o - res_o;
+  std::cout << GridLogMessage << "Meooe   |full - compressed|^2 / |full|^2 = " << norm2(diff_o) / norm2(ref_o) << std::endl;
+  assert(norm2(diff_o) / norm2(ref_o) < 1.0e-24);
+
+  std::cout << GridLogMessage << "Done" << std::endl;
+  Grid_finalize();
+}
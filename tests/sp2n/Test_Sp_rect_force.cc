@@ -0,0 +1,98 @@
+#include <Grid/Grid.h>
+
+using namespace Grid;
+
+// Finite difference check of the rectangle improved gauge actions for Sp(2N).
+// The force is built from the padded cell staples, the action from Cshifts,
+// so agreement also cross checks the two staple paths.
+template <class Action>
+void CheckForce(Action &action, GridParallelRNG &pRNG, LatticeGaugeField &U)
+{
+  GridBase *grid = U.Grid();
+
+  ComplexD S = action.S(U);
+
+  LatticeGaugeField UdSdU(grid);
+  action.deriv(U, UdSdU);
+
+  RealD dt = 0.0001;
+  LatticeColourMatrix mommu(grid), forcemu(grid);
+  LatticeGaugeField mom(grid), Uprime(grid);
+  for (int mu = 0; mu < Nd; mu++) {
+    Sp<Nc>::GaussianFundamentalLieAlgebraMatrix(pRNG, mommu);
+    PokeIndex<LorentzIndex>(mom, mommu, mu);
+  }
+  {
+    autoView(Uprime_v, Uprime, CpuWrite);
+    autoView(U_v, U, CpuRead);
+    autoView(mom_v, mom, CpuRead);
+    thread_foreach(ss, mom_v, {
+      for (int mu = 0; mu < Nd; mu++) {
+        Uprime_v[ss]._internal[mu] = Exponentiate(mom_v[ss]._internal[mu], dt, 12) * U_v[ss]._internal[mu];
+      }
+    });
+  }
+
+  ComplexD Sprime = action.S(Uprime);
+
+  LatticeComplex dS(grid);
+  dS = Zero();
+  for (int mu = 0; mu < Nd; mu++) {
+    forcemu = PeekIndex<LorentzIndex>(UdSdU, mu);
+    mommu   = PeekIndex<LorentzIndex>(mom, mu);
+    dS = dS - trace(mommu * forcemu) * dt * 2.0;
+  }
+  ComplexD dSpred = sum(dS);
+
+  std::cout << GridLogMessage << action.action_name() << std::endl;
+  std::cout << GridLogMessage << " S      " << S << std::endl;
+  std::cout << GridLogMessage << " Sprime " << Sprime << std::endl;
+  std::cout << GridLogMessage << "dS (S' - S)          :" << Sprime - S << std::endl;
+  std::cout << GridLogMessage << "predict dS (force)   :" << dSpred << std::endl;
+  RealD err = fabs(real(Sprime - S - dSpred)) / fabs(real(Sprime - S));
+  std::cout << GridLogMessage << "relative error " << err << std::endl;
+  assert(err < 1.0e-2);
+}
+
+int main(int argc, char **argv)
+{
+  Grid_init(&argc, &argv);
+
+  GridCartesian *UGrid = SpaceTimeGrid::makeFourDimGrid(GridDefaultLatt(), GridDefaultSimd(Nd, vComplex::Nsimd()), GridDefaultMpi());
+
+  GridParallelRNG pRNG(UGrid);
+  pRNG.SeedFixedIntegers(std::vector<int>({45, 12, 81, 9}));
+
+  LatticeGaugeField U(UGrid);
+  Sp<Nc>::HotConfiguration(pRNG, U);
+
+  RealD beta = 6.8;
+
+  SpWilsonGaugeActionR       Wilson(beta);
+  SpIwasakiGaugeActionR      Iwasaki(beta);
+  SpSymanzikGaugeActionR     Symanzik(beta);
+  SpDBW2GaugeActionR         DBW2(beta);
+  SpPlaqPlusRectangleActionR PlaqRect(beta, -0.1);
+
+  CheckForce(Wilson,   pRNG, U);
+  CheckForce(Iwasaki,  pRNG, U);
+  CheckForce(Symanzik, pRNG, U);
+  CheckForce(DBW2,     pRNG, U);
+  CheckForce(PlaqRect, pRNG, U);
+
+  ////////////////////////////////////
+  // The Wilson limit of the rectangle action
+  ////////////////////////////////////
+  SpPlaqPlusRectangleActionR PlaqOnly(beta, 0.0);
+  LatticeGaugeField dSW(UGrid), dSP(UGrid), diff(UGrid);
+  Wilson.deriv(U, dSW);
+  PlaqOnly.deriv(U, dSP);
+  diff = dSW - dSP;
+  std::cout << GridLogMessage << "|dS_wilson - dS_plaq(c1=0)|^2 / |dS_wilson|^2 = " << norm2(diff) / norm2(dSW) << std::endl;
+  assert(norm2(diff) / norm2(dSW) < 1.0e-24);
+  std::cout << GridLogMessage << "S_wilson " << Wilson.S(U) << " S_plaq(c1=0) " << PlaqOnly.S(U) << std::endl;
+  assert(fabs(Wilson.S(U) - PlaqOnly.S(U)) < 1.0e-8 * fabs(Wilson.S(U)));
+
+  std::cout << GridLogMessage << "Done" << std::endl;
+  Grid_finalize();
+}
@@ -0,0 +1,81 @@
+#include <Grid/Grid.h>
+
+using namespace Grid;
+
+template <class Group>
+static void check_fundamental(GridCartesian *grid, GridParallelRNG &pRNG) {
+  typename Group::LatticeMatrix in(grid), out(grid), out_ref(grid);
+  typename Group::LatticeAlgebraVector h(grid), h_ref(grid);
+  gaussian(pRNG, in);
+
+  Group::projectOnAlgebra(h, in, 0.7);
+  Group::projectOnAlgebraReference(h_ref, in, 0.7);
+  RealD err = norm2(h - h_ref) / norm2(h_ref);
+  std::cout << GridLogMessage << "projectOnAlgebra kernel vs reference " << err << std::endl;
+  assert(err < 1e-12);
+
+  Group::FundamentalLieAlgebraMatrix(h, out, 0.3);
+  Group::FundamentalLieAlgebraMatrixReference(h, out_ref, 0.3);
+  err = norm2(out - out_ref) / norm2(out_ref);
+  std::cout << GridLogMessage << "FundamentalLieAlgebraMatrix kernel vs reference " << err << std::endl;
+  assert(err < 1e-12);
+}
+
+template <class TwoIndexGroup>
+static void check_two_index(GridCartesian *grid, GridParallelRNG &pRNG) {
+  typename TwoIndexGroup::LatticeTwoIndexMatrix in(grid);
+  typename TwoIndexGroup::LatticeAlgebraVector h(grid), h_ref(grid);
+  gaussian(pRNG, in);
+
+  TwoIndexGroup::projectOnAlgebra(h, in, 0.7);
+  TwoIndexGroup::projectOnAlgebraReference(h_ref, in, 0.7);
+  RealD err = norm2(h - h_ref) / norm2(h_ref);
+  std::cout << GridLogMessage << "two-index projectOnAlgebra kernel vs reference " << err << std::endl;
+  assert(err < 1e-12);
+
+  // Each generator on its own with a random coefficient field, then all of
+  // them together
+  typename TwoIndexGroup::LatticeTwoIndexMatrix out(grid), out_ref(grid);
+  LatticeComplex ca(grid);
+  for (int a = 0; a < TwoIndexGroup::NumGenerators; a++) {
+    gaussian(pRNG, ca);
+    ca = real(ca);
+    h = Zero();
+    pokeColour(h, ca, a);
+    TwoIndexGroup::TwoIndexLieAlgebraMatrix(h, out, 0.3);
+    TwoIndexGroup::TwoIndexLieAlgebraMatrixReference(h, out_ref, 0.3);
+    err = norm2(out - out_ref) / norm2(out_ref);
+    assert(err < 1e-12);
+  }
+  gaussian(pRNG, h);
+  h = real(h);
+  TwoIndexGroup::TwoIndexLieAlgebraMatrix(h, out, 0.3);
+  TwoIndexGroup::TwoIndexLieAlgebraMatrixReference(h, out_ref, 0.3);
+  err = norm2(out - out_ref) / norm2(out_ref);
+  std::cout << GridLogMessage << "two-index TwoIndexLieAlgebraMatrix kernel vs reference " << err << std::endl;
+  assert(err < 1e-12);
+}
+
+int main(int argc, char** argv) {
+  Grid_init(&argc, &argv);
+
+  Coordinate latt_size = GridDefaultLatt();
+  Coordinate simd_layout = GridDefaultSimd(Nd, vComplex::Nsimd());
+  Coordinate mpi_layout = GridDefaultMpi();
+
+  GridCartesian Grid(latt_size, simd_layout, mpi_layout);
+  GridParallelRNG pRNG(&Grid);
+  pRNG.SeedFixedIntegers(std::vector<int>({1, 2, 3, 4}));
+
+  std::cout << GridLogMessage << "Sp(" << Nc << ")" << std::endl;
+  check_fundamental<Sp<Nc> >(&Grid, pRNG);
+  check_two_index<Sp_TwoIndex<Nc, Symmetric> >(&Grid, pRNG);
+  check_two_index<Sp_TwoIndex<Nc, AntiSymmetric> >(&Grid, pRNG);
+
+  std::cout << GridLogMessage << "SU(" << Nc << ")" << std::endl;
+  check_fundamental<SU<Nc> >(&Grid, pRNG);
+  check_two_index<SU_TwoIndex<Nc, Symmetric> >(&Grid, pRNG);
+  check_two_index<SU_TwoIndex<Nc, AntiSymmetric> >(&Grid, pRNG);
+
+  Grid_finalize();
+}
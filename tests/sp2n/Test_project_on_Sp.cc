@@ -113,6 +113,41 @@ void test_group_projections(T U) {
   assert(is_element_of_sp2n_group(U));
 }
 
+template <typename T>
+void test_polar_projection(T U, GridParallelRNG& pRNG) {
+  RealD delta = 1.0e-3;
+  T noise(U.Grid());
+  T diff(U.Grid());
+
+  std::string name = "ProjectOnSpGroupPolar";
+  std::cout << GridLogMessage << "Testing " << name << std::endl;
+
+  U = ProjectOnSpGroup(U);
+  std::cout << GridLogMessage << "Identity on group elements" << std::endl;
+  diff = U - ProjectOnSpGroupPolar(U);
+  std::cout << GridLogMessage << "|U - P(U)|^2 / |U|^2 = " << norm2(diff) / norm2(U) << std::endl;
+  assert(norm2(diff) / norm2(U) < 1e-24);
+
+  std::cout << GridLogMessage << "Apply to slightly deformed matrix" << std::endl;
+  gaussian(pRNG, noise);
+  T V(U.Grid());
+  V = U + delta * noise;
+  V = ProjectOnSpGroupPolar(V);
+  assert(is_element_of_sp2n_group(V));
+
+  // The polar factor is the nearest group element to the deformed matrix
+  T M(U.Grid());
+  T W(U.Grid());
+  M = U + delta * noise;
+  W = ProjectOnSpGroup(M);
+  diff = V - M;
+  RealD dpolar = norm2(diff);
+  diff = W - M;
+  RealD dgs = norm2(diff);
+  std::cout << GridLogMessage << "|polar - M|^2 = " << dpolar << " |Gram-Schmidt - M|^2 = " << dgs << std::endl;
+  assert(dpolar <= dgs);
+}
+
 template <typename T>
 bool has_correct_algebra_block_structure(const T& U) {
   // this only checks for the anti-hermitian part of the algebra
@@ -235,6 +270,8 @@ int main(int argc, char** argv) {
   test_group_projections(U);
   U = PeekIndex<LorentzIndex>(Umu, 1);
   test_algebra_projections(U);
+  U = PeekIndex<LorentzIndex>(Umu, 2);
+  test_polar_projection(U, pRNG);
 
   Grid_finalize();
 }